@@ -0,0 +1,206 @@
+/**
+ *
+ * @file Arena.cpp
+ *
+ * @brief Monotonic memory arena that releases everything it handed out at once
+ *
+ * @author Josh Wiley
+ *
+ * @details Implements the Arena class
+ *
+ */
+//
+//  Preprocessor Directives  ///////////////////////////////////////////////////
+//
+#ifndef ARENA_CPP_
+#define ARENA_CPP_
+//
+//  Header Files  //////////////////////////////////////////////////////////////
+//
+#include <cstdint>
+#include <new>
+#include "Arena.h"
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Creates an empty arena; the first chunk is obtained on the first
+ *          allocation
+ *
+ * @param[in] chunk_size
+ *            Size of the first chunk (later chunks double, up to 64 times
+ *            this size)
+ *
+ */
+Arena::Arena(size_t chunk_size)
+    : cursor_(nullptr), limit_(nullptr), chunk_size_(chunk_size),
+      allocation_count_(0), bytes_allocated_(0), bytes_reserved_(0) {}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Destructor, returns every chunk to the global heap in one pass
+ *
+ */
+Arena::~Arena()
+{
+    // Free chunks.
+    for (auto chunk : chunks_)
+    {
+        // Free.
+        ::operator delete(chunk);
+    }
+}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Bumps the cursor of the current chunk, obtaining a new chunk when
+ *          the request does not fit
+ *
+ * @param[in] bytes
+ *            Number of bytes requested
+ *
+ * @param[in] alignment
+ *            Required alignment (a power of two)
+ *
+ * @return Pointer to the allocated memory
+ *
+ */
+void* Arena::allocate(size_t bytes, size_t alignment)
+{
+    // Align cursor.
+    auto address = reinterpret_cast< std::uintptr_t >(cursor_);
+    auto aligned = (address + alignment - 1) & ~(std::uintptr_t)(alignment - 1);
+
+    // Does not fit?
+    if (cursor_ == nullptr || aligned + bytes > reinterpret_cast< std::uintptr_t >(limit_))
+    {
+        // New chunk (with room for alignment).
+        add_chunk(bytes + alignment);
+
+        // Align cursor in new chunk.
+        address = reinterpret_cast< std::uintptr_t >(cursor_);
+        aligned = (address + alignment - 1) & ~(std::uintptr_t)(alignment - 1);
+    }
+
+    // Bump.
+    cursor_ = reinterpret_cast< char* >(aligned + bytes);
+
+    // Count.
+    allocation_count_++;
+    bytes_allocated_ += bytes;
+
+    // Return.
+    return reinterpret_cast< void* >(aligned);
+}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Memory is not reused individually; it is returned to the global
+ *          heap when the arena is destroyed
+ *
+ */
+void Arena::deallocate(void*, size_t) {}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Returns number of allocations served
+ *
+ * @return Number of allocations served
+ *
+ */
+size_t Arena::allocation_count() const
+{
+    // Return count.
+    return allocation_count_;
+}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Returns number of bytes handed out (excluding alignment padding)
+ *
+ * @return Number of bytes handed out
+ *
+ */
+size_t Arena::bytes_allocated() const
+{
+    // Return bytes.
+    return bytes_allocated_;
+}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Returns number of bytes obtained from the global heap
+ *
+ * @return Number of bytes obtained from the global heap
+ *
+ */
+size_t Arena::bytes_reserved() const
+{
+    // Return bytes.
+    return bytes_reserved_;
+}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Returns number of chunks obtained from the global heap
+ *
+ * @return Number of chunks obtained from the global heap
+ *
+ */
+size_t Arena::chunk_count() const
+{
+    // Return count.
+    return chunks_.size();
+}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Obtains a new chunk from the global heap and makes it current
+ *
+ * @param[in] min_size
+ *            Minimum number of bytes the chunk must hold
+ *
+ */
+void Arena::add_chunk(size_t min_size)
+{
+    // Size of chunk.
+    auto size = chunk_size_ < min_size ? min_size : chunk_size_;
+
+    // Allocate.
+    auto chunk = static_cast< char* >(::operator new(size));
+    chunks_.push_back(chunk);
+    bytes_reserved_ += size;
+
+    // Make current.
+    cursor_ = chunk;
+    limit_ = chunk + size;
+
+    // Grow next chunk (bounded to limit waste).
+    if (chunks_.size() < 7)
+    {
+        // Double.
+        chunk_size_ *= 2;
+    }
+}
+//
+//  Terminating Precompiler Directives  ////////////////////////////////////////
+//
+#endif // ARENA_CPP_
+//
@@ -0,0 +1,61 @@
+/**
+ *
+ * @file Arena.h
+ *
+ * @brief Monotonic memory arena that releases everything it handed out at once
+ *
+ * @author Josh Wiley
+ *
+ * @details Defines the Arena class
+ *
+ */
+//
+//  Preprocessor Directives  ///////////////////////////////////////////////////
+//
+#ifndef ARENA_H_
+#define ARENA_H_
+//
+//  Header Files  //////////////////////////////////////////////////////////////
+//
+#include <cstddef>
+#include <vector>
+//
+//  Class Definition  //////////////////////////////////////////////////////////
+//
+class Arena
+{
+
+// Public members.
+public:
+    Arena(size_t chunk_size = 64 * 1024); /**< Parameterized constructor */
+    Arena(const Arena&) = delete; /**< Not copyable (owns its chunks) */
+    ~Arena(); /**< Destructor, frees every chunk */
+
+    void* allocate(size_t, size_t); /**< Returns aligned memory carved from the current chunk */
+    void deallocate(void*, size_t); /**< Records a release (memory is reclaimed when the arena is destroyed) */
+
+    size_t allocation_count() const; /**< Returns number of allocations served */
+    size_t bytes_allocated() const; /**< Returns number of bytes handed out */
+    size_t bytes_reserved() const; /**< Returns number of bytes obtained from the global heap */
+    size_t chunk_count() const; /**< Returns number of chunks obtained from the global heap */
+
+    Arena& operator=(const Arena&) = delete; /**< Not assignable (owns its chunks) */
+
+// Private members.
+private:
+    std::vector< char* > chunks_; /**< Chunks obtained from the global heap */
+    char* cursor_; /**< Next free byte in the current chunk */
+    char* limit_; /**< End of the current chunk */
+    size_t chunk_size_; /**< Size of the next chunk to obtain */
+    size_t allocation_count_; /**< Number of allocations served */
+    size_t bytes_allocated_; /**< Number of bytes handed out */
+    size_t bytes_reserved_; /**< Number of bytes obtained from the global heap */
+
+    void add_chunk(size_t); /**< Obtains a new chunk of at least the given size */
+
+};
+//
+//  Terminating Precompiler Directives  ////////////////////////////////////////
+//
+#endif // ARENA_H_
+//
@@ -0,0 +1,152 @@
+/**
+ *
+ * @file ArenaAllocator.cpp
+ *
+ * @brief Standard library allocator that draws from an Arena
+ *
+ * @author Josh Wiley
+ *
+ * @details Implements the ArenaAllocator class
+ *
+ */
+//
+//  Preprocessor Directives  ///////////////////////////////////////////////////
+//
+#ifndef ARENA_ALLOCATOR_CPP_
+#define ARENA_ALLOCATOR_CPP_
+//
+//  Header Files  //////////////////////////////////////////////////////////////
+//
+#include "ArenaAllocator.h"
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Creates an allocator for an arena; the arena is kept alive for as
+ *          long as any container allocates from it
+ *
+ * @param[in] arena_ptr
+ *            Arena to allocate from, or null to use the global heap
+ *
+ */
+template<typename T>
+ArenaAllocator<T>::ArenaAllocator(std::shared_ptr< Arena > arena_ptr) : arena_ptr_(arena_ptr) {}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Copies an allocator for another type (used by node-based
+ *          containers to allocate their nodes from the same arena)
+ *
+ */
+template<typename T>
+template<typename U>
+ArenaAllocator<T>::ArenaAllocator(const ArenaAllocator< U >& origin) : arena_ptr_(origin.arena()) {}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Allocates uninitialized storage for a number of objects
+ *
+ * @param[in] count
+ *            Number of objects
+ *
+ * @return Pointer to the storage
+ *
+ */
+template<typename T>
+T* ArenaAllocator<T>::allocate(size_t count)
+{
+    // Global heap?
+    if (arena_ptr_ == nullptr)
+    {
+        // Allocate from global heap.
+        return static_cast< T* >(::operator new(count * sizeof(T)));
+    }
+
+    // Allocate from arena.
+    return static_cast< T* >(arena_ptr_->allocate(count * sizeof(T), alignof(T)));
+}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Releases storage for a number of objects
+ *
+ * @param[in] ptr
+ *            Pointer to the storage
+ *
+ * @param[in] count
+ *            Number of objects
+ *
+ */
+template<typename T>
+void ArenaAllocator<T>::deallocate(T* ptr, size_t count)
+{
+    // Global heap?
+    if (arena_ptr_ == nullptr)
+    {
+        // Free to global heap.
+        ::operator delete(ptr);
+
+        // Return.
+        return;
+    }
+
+    // Release to arena.
+    arena_ptr_->deallocate(ptr, count * sizeof(T));
+}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Returns the arena this allocator draws from
+ *
+ * @return Smart pointer to the arena (null for the global heap)
+ *
+ */
+template<typename T>
+std::shared_ptr< Arena > ArenaAllocator<T>::arena() const
+{
+    // Return arena.
+    return arena_ptr_;
+}
+//
+//  Non-member Operator Implementation  ////////////////////////////////////////
+//
+/**
+ *
+ * @details Storage from one allocator can be released by the other when they
+ *          share an arena
+ *
+ */
+template<typename T, typename U>
+bool operator==(const ArenaAllocator< T >& lhs, const ArenaAllocator< U >& rhs)
+{
+    // Compare arenas.
+    return lhs.arena() == rhs.arena();
+}
+//
+//  Non-member Operator Implementation  ////////////////////////////////////////
+//
+/**
+ *
+ * @details Inverse of operator==
+ *
+ */
+template<typename T, typename U>
+bool operator!=(const ArenaAllocator< T >& lhs, const ArenaAllocator< U >& rhs)
+{
+    // Compare arenas.
+    return !(lhs == rhs);
+}
+//
+//  Terminating Precompiler Directives  ////////////////////////////////////////
+//
+#endif // ARENA_ALLOCATOR_CPP_
+//
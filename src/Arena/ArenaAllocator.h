@@ -0,0 +1,62 @@
+/**
+ *
+ * @file ArenaAllocator.h
+ *
+ * @brief Standard library allocator that draws from an Arena
+ *
+ * @author Josh Wiley
+ *
+ * @details Defines the ArenaAllocator class
+ *
+ */
+//
+//  Preprocessor Directives  ///////////////////////////////////////////////////
+//
+#ifndef ARENA_ALLOCATOR_H_
+#define ARENA_ALLOCATOR_H_
+//
+//  Header Files  //////////////////////////////////////////////////////////////
+//
+#include <cstddef>
+#include <memory>
+#include "Arena.h"
+//
+//  Class Definition  //////////////////////////////////////////////////////////
+//
+template<class T>
+class ArenaAllocator
+{
+
+// Public members.
+public:
+    typedef T value_type; /**< Type of allocated objects */
+
+    ArenaAllocator(std::shared_ptr< Arena > arena_ptr = std::shared_ptr< Arena >(nullptr)); /**< Parameterized constructor */
+    template<class U>
+    ArenaAllocator(const ArenaAllocator< U >&); /**< Converting copy constructor */
+
+    T* allocate(size_t); /**< Allocates storage for a number of objects */
+    void deallocate(T*, size_t); /**< Releases storage for a number of objects */
+    std::shared_ptr< Arena > arena() const; /**< Returns the arena allocated from (null for the global heap) */
+
+// Private members.
+private:
+    std::shared_ptr< Arena > arena_ptr_; /**< Arena to allocate from, null for the global heap */
+
+};
+//
+//  Non-member Operators  //////////////////////////////////////////////////////
+//
+template<class T, class U>
+bool operator==(const ArenaAllocator< T >&, const ArenaAllocator< U >&); /**< Allocators are equal when they share an arena */
+template<class T, class U>
+bool operator!=(const ArenaAllocator< T >&, const ArenaAllocator< U >&); /**< Allocators differ when their arenas differ */
+//
+//  Implementation Files  //////////////////////////////////////////////////////
+//
+#include "ArenaAllocator.cpp"
+//
+//  Terminating Precompiler Directives  ////////////////////////////////////////
+//
+#endif // ARENA_ALLOCATOR_H_
+//
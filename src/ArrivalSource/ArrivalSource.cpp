@@ -0,0 +1,34 @@
+/**
+ *
+ * @file ArrivalSource.cpp
+ *
+ * @brief Abstract base class for streams of customer arrivals
+ *
+ * @author Josh Wiley
+ *
+ * @details Implements the ArrivalSource abstract base class
+ *
+ */
+//
+//  Preprocessor Directives  ///////////////////////////////////////////////////
+//
+#ifndef ARRIVAL_SOURCE_CPP_
+#define ARRIVAL_SOURCE_CPP_
+//
+//  Header Files  //////////////////////////////////////////////////////////////
+//
+#include "ArrivalSource.h"
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Destructor
+ *
+ */
+ArrivalSource::~ArrivalSource() {}
+//
+//  Terminating Precompiler Directives  ////////////////////////////////////////
+//
+#endif // ARRIVAL_SOURCE_CPP_
+//
@@ -0,0 +1,40 @@
+/**
+ *
+ * @file ArrivalSource.h
+ *
+ * @brief Abstract base class for streams of customer arrivals
+ *
+ * @author Josh Wiley
+ *
+ * @details Defines the ArrivalSource abstract base class
+ *
+ */
+//
+//  Preprocessor Directives  ///////////////////////////////////////////////////
+//
+#ifndef ARRIVAL_SOURCE_H_
+#define ARRIVAL_SOURCE_H_
+//
+//  Header Files  //////////////////////////////////////////////////////////////
+//
+#include <cstddef>
+#include "../ServiceQueueSimulation/Customer.h"
+//
+//  Class Definition  //////////////////////////////////////////////////////////
+//
+class ArrivalSource
+{
+
+// Public members.
+public:
+    virtual ~ArrivalSource(); /**< Destructor */
+
+    virtual bool next(Customer&) = 0; /**< Takes the next arrival into the out parameter, returns boolean indicating one was left */
+    virtual bool peek_time(unsigned int&) = 0; /**< Returns the next arrival time via out parameter without taking it, returns boolean indicating one is left */
+    virtual size_t size_hint() const = 0; /**< Returns number of arrivals expected to be left (0 if unknown) */
+};
+//
+//  Terminating Precompiler Directives  ////////////////////////////////////////
+//
+#endif // ARRIVAL_SOURCE_H_
+//
@@ -0,0 +1,170 @@
+/**
+ *
+ * @file FeedArrivalSource.cpp
+ *
+ * @brief Arrival source reading customers streamed by another thread
+ *
+ * @author Josh Wiley
+ *
+ * @details Implements the FeedArrivalSource class
+ *
+ */
+//
+//  Preprocessor Directives  ///////////////////////////////////////////////////
+//
+#ifndef FEED_ARRIVAL_SOURCE_CPP_
+#define FEED_ARRIVAL_SOURCE_CPP_
+#define FEED_RUN_LENGTH (size_t) 256
+//
+//  Header Files  //////////////////////////////////////////////////////////////
+//
+#include <thread>
+#include "FeedArrivalSource.h"
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Allocates the run buffer; this object is the feed's only consumer
+ *
+ * @param[in] feed_ptr
+ *            Queue of customers in order of arrival, filled (and finally
+ *            closed) by a single producer thread
+ *
+ */
+FeedArrivalSource::FeedArrivalSource(std::shared_ptr< QueueSpsc< Customer > > feed_ptr)
+    : feed_ptr_(feed_ptr), run_(FEED_RUN_LENGTH), run_size_(0), run_cursor_(0) {}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Destructor
+ *
+ */
+FeedArrivalSource::~FeedArrivalSource() {}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Takes the next buffered customer
+ *
+ * @param[out] customer
+ *             Assigned the next arrival
+ *
+ * @return Boolean value indicating whether an arrival was left
+ *
+ */
+bool FeedArrivalSource::next(Customer& customer)
+{
+    // Exhausted?
+    if (!fill())
+    {
+        // None left.
+        return false;
+    }
+
+    // Take.
+    customer = run_[run_cursor_++];
+
+    // Taken.
+    return true;
+}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Returns the arrival time of the next buffered customer
+ *
+ * @param[out] time
+ *             Assigned the next arrival time
+ *
+ * @return Boolean value indicating whether an arrival is left
+ *
+ */
+bool FeedArrivalSource::peek_time(unsigned int& time)
+{
+    // Exhausted?
+    if (!fill())
+    {
+        // None left.
+        return false;
+    }
+
+    // Peek.
+    time = run_[run_cursor_].arrival_time();
+
+    // Available.
+    return true;
+}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Returns number of customers buffered but not taken (the total is
+ *          unknown until the producer closes the feed)
+ *
+ * @return Number of customers buffered but not taken
+ *
+ */
+size_t FeedArrivalSource::size_hint() const
+{
+    // Return buffered.
+    return run_size_ - run_cursor_;
+}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Pulls the next run of customers once the buffer is drained,
+ *          yielding to the producer until it delivers or closes the feed
+ *
+ * @return Boolean value indicating whether a customer is available
+ *
+ */
+bool FeedArrivalSource::fill()
+{
+    // Buffered?
+    if (run_cursor_ != run_size_)
+    {
+        // Available.
+        return true;
+    }
+
+    // Wait for the producer.
+    while (true)
+    {
+        // Closed? (Checked before pulling, so nothing pushed before closing is missed.)
+        auto closed = feed_ptr_->closed();
+
+        // Pull run.
+        run_size_ = feed_ptr_->dequeue_batch(run_.data(), run_.size());
+        run_cursor_ = 0;
+
+        // Pulled some?
+        if (run_size_ != 0)
+        {
+            // Available.
+            return true;
+        }
+
+        // Stream over?
+        if (closed)
+        {
+            // None left.
+            return false;
+        }
+
+        // Let the producer run.
+        std::this_thread::yield();
+    }
+}
+//
+//  Terminating Precompiler Directives  ////////////////////////////////////////
+//
+#endif // FEED_ARRIVAL_SOURCE_CPP_
+//
@@ -0,0 +1,53 @@
+/**
+ *
+ * @file FeedArrivalSource.h
+ *
+ * @brief Arrival source reading customers streamed by another thread
+ *
+ * @author Josh Wiley
+ *
+ * @details Defines the FeedArrivalSource class
+ *
+ */
+//
+//  Preprocessor Directives  ///////////////////////////////////////////////////
+//
+#ifndef FEED_ARRIVAL_SOURCE_H_
+#define FEED_ARRIVAL_SOURCE_H_
+//
+//  Header Files  //////////////////////////////////////////////////////////////
+//
+#include <memory>
+#include <vector>
+#include "../Queue/QueueSpsc.h"
+#include "ArrivalSource.h"
+//
+//  Class Definition  //////////////////////////////////////////////////////////
+//
+class FeedArrivalSource final : public ArrivalSource
+{
+
+// Public members.
+public:
+    FeedArrivalSource(std::shared_ptr< QueueSpsc< Customer > >); /**< Parameterized constructor */
+    ~FeedArrivalSource(); /**< Destructor */
+
+    bool next(Customer&) override; /**< Takes the next arrival into the out parameter, waiting for the producer, returns boolean indicating one was left */
+    bool peek_time(unsigned int&) override; /**< Returns the next arrival time via out parameter without taking it, waiting for the producer, returns boolean indicating one is left */
+    size_t size_hint() const override; /**< Returns number of arrivals already pulled but not taken */
+
+// Private members.
+private:
+    bool fill(); /**< Pulls the next run from the feed if the buffer is drained, returns boolean indicating an arrival is available */
+
+    std::shared_ptr< QueueSpsc< Customer > > feed_ptr_; /**< Queue filled (and finally closed) by a single producer thread */
+    std::vector< Customer > run_; /**< Customers pulled from the feed in one batch */
+    size_t run_size_; /**< Number of customers in run_ */
+    size_t run_cursor_; /**< Next customer in run_ */
+
+};
+//
+//  Terminating Precompiler Directives  ////////////////////////////////////////
+//
+#endif // FEED_ARRIVAL_SOURCE_H_
+//
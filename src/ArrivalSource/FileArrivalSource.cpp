@@ -0,0 +1,223 @@
+/**
+ *
+ * @file FileArrivalSource.cpp
+ *
+ * @brief Arrival source reading customers from a text file
+ *
+ * @author Josh Wiley
+ *
+ * @details Implements the FileArrivalSource class. Customer lines are either
+ *          in the form written by Logger::log_customer_list
+ *          ("1. Arrival time: 5, Transaction time: 7") or plain pairs
+ *          ("5 7"); any other line separates data sets. Customers must be
+ *          sorted by arrival time.
+ *
+ */
+//
+//  Preprocessor Directives  ///////////////////////////////////////////////////
+//
+#ifndef FILE_ARRIVAL_SOURCE_CPP_
+#define FILE_ARRIVAL_SOURCE_CPP_
+//
+//  Header Files  //////////////////////////////////////////////////////////////
+//
+#include <cstdio>
+#include "FileArrivalSource.h"
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Opens the file; nothing is read until the first customer is
+ *          needed
+ *
+ * @param[in] file_path
+ *            Path to the file
+ *
+ * @param[in] data_set
+ *            Which run of consecutive customer lines to read (1 for the
+ *            first, so a data.txt written by PA05 can be replayed by set)
+ *
+ */
+FileArrivalSource::FileArrivalSource(std::string file_path, unsigned int data_set)
+    : file_stream_(file_path), data_set_(data_set), runs_seen_(0),
+      in_run_(false), has_lookahead_(false) {}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Destructor
+ *
+ */
+FileArrivalSource::~FileArrivalSource() {}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Takes the lookahead customer
+ *
+ * @param[out] customer
+ *             Assigned the next arrival
+ *
+ * @return Boolean value indicating whether an arrival was left
+ *
+ */
+bool FileArrivalSource::next(Customer& customer)
+{
+    // Exhausted?
+    if (!fill())
+    {
+        // None left.
+        return false;
+    }
+
+    // Take.
+    customer = lookahead_;
+    has_lookahead_ = false;
+
+    // Taken.
+    return true;
+}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Returns the arrival time of the lookahead customer
+ *
+ * @param[out] time
+ *             Assigned the next arrival time
+ *
+ * @return Boolean value indicating whether an arrival is left
+ *
+ */
+bool FileArrivalSource::peek_time(unsigned int& time)
+{
+    // Exhausted?
+    if (!fill())
+    {
+        // None left.
+        return false;
+    }
+
+    // Peek.
+    time = lookahead_.arrival_time();
+
+    // Available.
+    return true;
+}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Returns 0, since the number of customers is unknown until the
+ *          file has been read
+ *
+ * @return 0
+ *
+ */
+size_t FileArrivalSource::size_hint() const
+{
+    // Unknown.
+    return 0;
+}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Reads lines until the next customer of the chosen data set,
+ *          unless the lookahead slot is already filled
+ *
+ * @return Boolean value indicating whether a customer is available
+ *
+ */
+bool FileArrivalSource::fill()
+{
+    // Already read?
+    if (has_lookahead_)
+    {
+        // Available.
+        return true;
+    }
+
+    // Line buffer.
+    auto line = std::string();
+
+    // Read until a customer of the data set, or past it.
+    while (runs_seen_ <= data_set_ && std::getline(file_stream_, line))
+    {
+        // Not a customer line?
+        if (!parse(line, lookahead_))
+        {
+            // Run over.
+            in_run_ = false;
+
+            // Next line.
+            continue;
+        }
+
+        // Run starting?
+        if (!in_run_)
+        {
+            // Count run.
+            in_run_ = true;
+            runs_seen_++;
+        }
+
+        // In the data set?
+        if (runs_seen_ == data_set_)
+        {
+            // Available.
+            has_lookahead_ = true;
+            return true;
+        }
+    }
+
+    // None left.
+    return false;
+}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Parses a line in either supported customer form
+ *
+ * @param[in] line
+ *            Line of text
+ *
+ * @param[out] customer
+ *             Assigned the customer on success
+ *
+ * @return Boolean value indicating whether the line held a customer
+ *
+ */
+bool FileArrivalSource::parse(const std::string& line, Customer& customer)
+{
+    // Fields.
+    auto arrival = 0u;
+    auto transaction = 0u;
+
+    // Logged or plain form?
+    if (
+        std::sscanf(line.c_str(), "%*u. Arrival time: %u, Transaction time: %u", &arrival, &transaction) == 2 ||
+        std::sscanf(line.c_str(), "%u %u", &arrival, &transaction) == 2
+    )
+    {
+        // Parsed.
+        customer = Customer(arrival, transaction);
+        return true;
+    }
+
+    // Not a customer.
+    return false;
+}
+//
+//  Terminating Precompiler Directives  ////////////////////////////////////////
+//
+#endif // FILE_ARRIVAL_SOURCE_CPP_
+//
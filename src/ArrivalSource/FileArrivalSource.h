@@ -0,0 +1,55 @@
+/**
+ *
+ * @file FileArrivalSource.h
+ *
+ * @brief Arrival source reading customers from a text file
+ *
+ * @author Josh Wiley
+ *
+ * @details Defines the FileArrivalSource class
+ *
+ */
+//
+//  Preprocessor Directives  ///////////////////////////////////////////////////
+//
+#ifndef FILE_ARRIVAL_SOURCE_H_
+#define FILE_ARRIVAL_SOURCE_H_
+//
+//  Header Files  //////////////////////////////////////////////////////////////
+//
+#include <string>
+#include <fstream>
+#include "ArrivalSource.h"
+//
+//  Class Definition  //////////////////////////////////////////////////////////
+//
+class FileArrivalSource final : public ArrivalSource
+{
+
+// Public members.
+public:
+    FileArrivalSource(std::string, unsigned int data_set = 1); /**< Parameterized constructor */
+    ~FileArrivalSource(); /**< Destructor */
+
+    bool next(Customer&) override; /**< Reads the next arrival into the out parameter, returns boolean indicating one was left */
+    bool peek_time(unsigned int&) override; /**< Returns the next arrival time via out parameter without taking it, returns boolean indicating one is left */
+    size_t size_hint() const override; /**< Returns 0 (unknown until the file is read) */
+
+// Private members.
+private:
+    bool fill(); /**< Reads the lookahead customer if needed, returns boolean indicating one is available */
+    static bool parse(const std::string&, Customer&); /**< Parses a customer line, returns boolean indicating success */
+
+    std::ifstream file_stream_; /**< File being read */
+    unsigned int data_set_; /**< Run of customer lines to read (1 for the first) */
+    unsigned int runs_seen_; /**< Runs of customer lines started so far */
+    bool in_run_; /**< Was the last line read a customer line? */
+    Customer lookahead_; /**< Customer read but not yet taken */
+    bool has_lookahead_; /**< Is lookahead_ valid? */
+
+};
+//
+//  Terminating Precompiler Directives  ////////////////////////////////////////
+//
+#endif // FILE_ARRIVAL_SOURCE_H_
+//
@@ -0,0 +1,120 @@
+/**
+ *
+ * @file ListArrivalSource.cpp
+ *
+ * @brief Arrival source reading a list of customers sorted by arrival time
+ *
+ * @author Josh Wiley
+ *
+ * @details Implements the ListArrivalSource class
+ *
+ */
+//
+//  Preprocessor Directives  ///////////////////////////////////////////////////
+//
+#ifndef LIST_ARRIVAL_SOURCE_CPP_
+#define LIST_ARRIVAL_SOURCE_CPP_
+//
+//  Header Files  //////////////////////////////////////////////////////////////
+//
+#include "ListArrivalSource.h"
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Starts at the front of the list
+ *
+ * @param[in] events_ptr
+ *            Customers, sorted by arrival time
+ *
+ */
+ListArrivalSource::ListArrivalSource(std::shared_ptr< std::list< Customer > > events_ptr)
+    : events_ptr_(events_ptr), cursor_(events_ptr->cbegin()), taken_(0) {}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Destructor
+ *
+ */
+ListArrivalSource::~ListArrivalSource() {}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Copies the customer under the cursor and advances
+ *
+ * @param[out] customer
+ *             Assigned the next arrival
+ *
+ * @return Boolean value indicating whether an arrival was left
+ *
+ */
+bool ListArrivalSource::next(Customer& customer)
+{
+    // Exhausted?
+    if (cursor_ == events_ptr_->cend())
+    {
+        // None left.
+        return false;
+    }
+
+    // Take and advance.
+    customer = *cursor_;
+    ++cursor_;
+    taken_++;
+
+    // Taken.
+    return true;
+}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Returns the arrival time of the customer under the cursor
+ *
+ * @param[out] time
+ *             Assigned the next arrival time
+ *
+ * @return Boolean value indicating whether an arrival is left
+ *
+ */
+bool ListArrivalSource::peek_time(unsigned int& time)
+{
+    // Exhausted?
+    if (cursor_ == events_ptr_->cend())
+    {
+        // None left.
+        return false;
+    }
+
+    // Peek.
+    time = cursor_->arrival_time();
+
+    // Available.
+    return true;
+}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Returns number of customers not yet taken
+ *
+ * @return Number of customers not yet taken
+ *
+ */
+size_t ListArrivalSource::size_hint() const
+{
+    // Return remaining.
+    return events_ptr_->size() - taken_;
+}
+//
+//  Terminating Precompiler Directives  ////////////////////////////////////////
+//
+#endif // LIST_ARRIVAL_SOURCE_CPP_
+//
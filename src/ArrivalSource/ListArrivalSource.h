@@ -0,0 +1,49 @@
+/**
+ *
+ * @file ListArrivalSource.h
+ *
+ * @brief Arrival source reading a list of customers sorted by arrival time
+ *
+ * @author Josh Wiley
+ *
+ * @details Defines the ListArrivalSource class
+ *
+ */
+//
+//  Preprocessor Directives  ///////////////////////////////////////////////////
+//
+#ifndef LIST_ARRIVAL_SOURCE_H_
+#define LIST_ARRIVAL_SOURCE_H_
+//
+//  Header Files  //////////////////////////////////////////////////////////////
+//
+#include <list>
+#include <memory>
+#include "ArrivalSource.h"
+//
+//  Class Definition  //////////////////////////////////////////////////////////
+//
+class ListArrivalSource final : public ArrivalSource
+{
+
+// Public members.
+public:
+    ListArrivalSource(std::shared_ptr< std::list< Customer > >); /**< Parameterized constructor */
+    ~ListArrivalSource(); /**< Destructor */
+
+    bool next(Customer&) override; /**< Takes the next arrival into the out parameter, returns boolean indicating one was left */
+    bool peek_time(unsigned int&) override; /**< Returns the next arrival time via out parameter without taking it, returns boolean indicating one is left */
+    size_t size_hint() const override; /**< Returns number of arrivals left */
+
+// Private members.
+private:
+    std::shared_ptr< std::list< Customer > > events_ptr_; /**< Customers, sorted by arrival time (kept alive, not copied) */
+    std::list< Customer >::const_iterator cursor_; /**< Next customer */
+    size_t taken_; /**< Number of customers taken so far */
+
+};
+//
+//  Terminating Precompiler Directives  ////////////////////////////////////////
+//
+#endif // LIST_ARRIVAL_SOURCE_H_
+//
@@ -0,0 +1,311 @@
+/**
+ *
+ * @file RandomArrivalSource.cpp
+ *
+ * @brief Arrival source generating customers with uniformly random arrival
+ *        times, in order of arrival
+ *
+ * @author Josh Wiley
+ *
+ * @details Implements the RandomArrivalSource class. Arrival times come from
+ *          the ordered-uniform spacings method: with E_1..E_(n+1) standard
+ *          exponentials and S_k their partial sums, S_k / S_(n+1) are the
+ *          order statistics of n uniforms, smallest first. The constructor
+ *          runs a copy of the spacing generator once to find S_(n+1); next()
+ *          then draws the same exponentials again, in batches, and hands out
+ *          each customer as its partial sum is reached. This gives the
+ *          distribution of drawing n uniform customers and sorting them, in
+ *          O(n) time and constant memory.
+ *
+ */
+//
+//  Preprocessor Directives  ///////////////////////////////////////////////////
+//
+#ifndef RANDOM_ARRIVAL_SOURCE_CPP_
+#define RANDOM_ARRIVAL_SOURCE_CPP_
+//
+//  Header Files  //////////////////////////////////////////////////////////////
+//
+#include <cmath>
+#include <algorithm>
+#include "RandomArrivalSource.h"
+#include "../Distribution/UniformDistribution.h"
+//
+//  Static Member Definitions  /////////////////////////////////////////////////
+//
+const size_t RandomArrivalSource::block_length;
+//
+//  Function Implementation  ///////////////////////////////////////////////////
+//
+/**
+ *
+ * @brief Returns the generator of a seed's transaction lengths
+ *
+ * @param[in] seed
+ *            Seed of the source
+ *
+ * @return Generator a long jump past the seed's spacing generator
+ *
+ */
+static Xoshiro256 transaction_parent(std::uint64_t seed)
+{
+    // Jump.
+    auto parent = Xoshiro256(seed);
+    parent.long_jump();
+
+    // Return.
+    return parent;
+}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Parameterized constructor with uniform transaction lengths
+ *
+ * @param[in] size
+ *            Number of customers to generate
+ *
+ * @param[in] arrival_min
+ *            Minimum arrival time
+ *
+ * @param[in] arrival_max
+ *            Maximum arrival time
+ *
+ * @param[in] transaction_min
+ *            Minimum transaction length
+ *
+ * @param[in] transaction_max
+ *            Maximum transaction length
+ *
+ * @param[in] seed
+ *            Seed of the random engines
+ *
+ */
+RandomArrivalSource::RandomArrivalSource(
+    unsigned int size,
+    unsigned int arrival_min,
+    unsigned int arrival_max,
+    unsigned int transaction_min,
+    unsigned int transaction_max,
+    std::uint64_t seed
+)
+    : RandomArrivalSource(
+          size,
+          arrival_min,
+          arrival_max,
+          std::make_shared< UniformDistribution >(transaction_min, transaction_max),
+          seed
+      ) {}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Parameterized constructor; sums all size + 1 spacings on a copy
+ *          of the spacing generator to fix the scale of the arrival times
+ *
+ * @param[in] size
+ *            Number of customers to generate
+ *
+ * @param[in] arrival_min
+ *            Minimum arrival time
+ *
+ * @param[in] arrival_max
+ *            Maximum arrival time
+ *
+ * @param[in] transaction
+ *            Distribution of transaction lengths
+ *
+ * @param[in] seed
+ *            Seed of the random engines
+ *
+ */
+RandomArrivalSource::RandomArrivalSource(
+    unsigned int size,
+    unsigned int arrival_min,
+    unsigned int arrival_max,
+    std::shared_ptr< const Distribution > transaction,
+    std::uint64_t seed
+)
+    : transaction_(transaction), spacing_engine_(Xoshiro256(seed)),
+      transaction_engine_(transaction_parent(seed)),
+      arrival_min_(arrival_min), arrival_max_(arrival_max),
+      scale_(0.0), partial_(0.0), left_(size),
+      block_size_(0), block_next_(0), has_lookahead_(false)
+{
+    // Sum all spacings on a copy (the stream does not depend on batch sizes).
+    auto total_engine = spacing_engine_;
+    auto total = 0.0;
+    for (auto done = (size_t) 0; done <= size; )
+    {
+        // Draw batch.
+        auto length = std::min(block_length, (size_t) size + 1 - done);
+        total_engine.fill_unit(units_, length);
+
+        // Accumulate exponentials (1 - u is in (0, 1]).
+        for (auto i = (size_t) 0; i < length; i++)
+        {
+            // Accumulate.
+            total -= std::log(1.0 - units_[i]);
+        }
+
+        // Advance.
+        done += length;
+    }
+
+    // Scale from a partial sum to an arrival time.
+    scale_ = ((double) arrival_max - arrival_min + 1.0) / total;
+}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Destructor
+ *
+ */
+RandomArrivalSource::~RandomArrivalSource() {}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Takes the lookahead customer
+ *
+ * @param[out] customer
+ *             Assigned the next arrival
+ *
+ * @return Boolean value indicating whether an arrival was left
+ *
+ */
+bool RandomArrivalSource::next(Customer& customer)
+{
+    // Exhausted?
+    if (!fill())
+    {
+        // None left.
+        return false;
+    }
+
+    // Take.
+    customer = lookahead_;
+    has_lookahead_ = false;
+
+    // Taken.
+    return true;
+}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Returns the arrival time of the lookahead customer
+ *
+ * @param[out] time
+ *             Assigned the next arrival time
+ *
+ * @return Boolean value indicating whether an arrival is left
+ *
+ */
+bool RandomArrivalSource::peek_time(unsigned int& time)
+{
+    // Exhausted?
+    if (!fill())
+    {
+        // None left.
+        return false;
+    }
+
+    // Peek.
+    time = lookahead_.arrival_time();
+
+    // Available.
+    return true;
+}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Returns number of customers not yet taken
+ *
+ * @return Number of customers not yet taken
+ *
+ */
+size_t RandomArrivalSource::size_hint() const
+{
+    // Return remaining.
+    return left_ + (block_size_ - block_next_) + (has_lookahead_ ? 1 : 0);
+}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Generates the next customer into the lookahead slot unless it is
+ *          already filled
+ *
+ * @return Boolean value indicating whether a customer is available
+ *
+ */
+bool RandomArrivalSource::fill()
+{
+    // Already generated?
+    if (has_lookahead_)
+    {
+        // Available.
+        return true;
+    }
+
+    // Batch used up?
+    if (block_next_ == block_size_)
+    {
+        // Exhausted?
+        if (left_ == 0)
+        {
+            // None left.
+            return false;
+        }
+
+        // Draw.
+        draw_block();
+    }
+
+    // Next order statistic (the partial sum stays below the total, so the time stays below arrival_max + 1).
+    partial_ -= std::log(1.0 - units_[block_next_]);
+    auto arrival = arrival_min_ + (unsigned int) (partial_ * scale_);
+
+    // Generate.
+    lookahead_ = Customer(std::min(arrival, arrival_max_), transactions_[block_next_]);
+    block_next_++;
+    has_lookahead_ = true;
+
+    // Available.
+    return true;
+}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Draws the uniforms of the next batch's spacings and the batch's
+ *          transaction lengths
+ *
+ */
+void RandomArrivalSource::draw_block()
+{
+    // Batch size.
+    block_size_ = std::min(block_length, (size_t) left_);
+    block_next_ = 0;
+    left_ -= (unsigned int) block_size_;
+
+    // Draw.
+    spacing_engine_.fill_unit(units_, block_size_);
+    transaction_->sample(transaction_engine_, transactions_, block_size_);
+}
+//
+//  Terminating Precompiler Directives  ////////////////////////////////////////
+//
+#endif // RANDOM_ARRIVAL_SOURCE_CPP_
+//
@@ -0,0 +1,82 @@
+/**
+ *
+ * @file RandomArrivalSource.h
+ *
+ * @brief Arrival source generating customers with uniformly random arrival
+ *        times, in order of arrival
+ *
+ * @author Josh Wiley
+ *
+ * @details Defines the RandomArrivalSource class
+ *
+ */
+//
+//  Preprocessor Directives  ///////////////////////////////////////////////////
+//
+#ifndef RANDOM_ARRIVAL_SOURCE_H_
+#define RANDOM_ARRIVAL_SOURCE_H_
+//
+//  Header Files  //////////////////////////////////////////////////////////////
+//
+#include <cstdint>
+#include <memory>
+#include "ArrivalSource.h"
+#include "../Random/Xoshiro256x4.h"
+#include "../Distribution/Distribution.h"
+//
+//  Class Definition  //////////////////////////////////////////////////////////
+//
+class RandomArrivalSource final : public ArrivalSource
+{
+
+// Public members.
+public:
+    RandomArrivalSource(
+        unsigned int size,
+        unsigned int arrival_min,
+        unsigned int arrival_max,
+        unsigned int transaction_min,
+        unsigned int transaction_max,
+        std::uint64_t seed
+    ); /**< Parameterized constructor (uniform transaction lengths) */
+    RandomArrivalSource(
+        unsigned int size,
+        unsigned int arrival_min,
+        unsigned int arrival_max,
+        std::shared_ptr< const Distribution > transaction,
+        std::uint64_t seed
+    ); /**< Parameterized constructor (transaction lengths drawn from a distribution) */
+    ~RandomArrivalSource(); /**< Destructor */
+
+    bool next(Customer&) override; /**< Generates the next arrival into the out parameter, returns boolean indicating one was left */
+    bool peek_time(unsigned int&) override; /**< Returns the next arrival time via out parameter without taking it, returns boolean indicating one is left */
+    size_t size_hint() const override; /**< Returns number of arrivals left */
+
+// Private members.
+private:
+    static const size_t block_length = 256; /**< Number of customers drawn per batch */
+
+    bool fill(); /**< Generates the lookahead customer if needed, returns boolean indicating one is available */
+    void draw_block(); /**< Draws the next batch of spacings and transaction lengths */
+
+    std::shared_ptr< const Distribution > transaction_; /**< Distribution of transaction lengths */
+    Xoshiro256x4 spacing_engine_; /**< Random engine for the arrival spacings (private to this source) */
+    Xoshiro256x4 transaction_engine_; /**< Random engine for the transaction lengths, far ahead of the spacings */
+    unsigned int arrival_min_; /**< Minimum arrival time */
+    unsigned int arrival_max_; /**< Maximum arrival time */
+    double scale_; /**< Arrival time per unit of partial sum (number of possible arrival times over the sum of all spacings) */
+    double partial_; /**< Sum of the spacings drawn so far */
+    unsigned int left_; /**< Number of customers not yet drawn */
+    double units_[block_length]; /**< Uniforms of the current batch's spacings */
+    unsigned int transactions_[block_length]; /**< Transaction lengths of the current batch */
+    size_t block_size_; /**< Number of customers in the current batch */
+    size_t block_next_; /**< Index of the next customer of the current batch */
+    Customer lookahead_; /**< Generated customer not yet taken */
+    bool has_lookahead_; /**< Is lookahead_ valid? */
+
+};
+//
+//  Terminating Precompiler Directives  ////////////////////////////////////////
+//
+#endif // RANDOM_ARRIVAL_SOURCE_H_
+//
@@ -0,0 +1,120 @@
+/**
+ *
+ * @file TraceArrivalSource.cpp
+ *
+ * @brief Arrival source reading a shared, read-only trace of customers
+ *
+ * @author Josh Wiley
+ *
+ * @details Implements the TraceArrivalSource class. The trace is only ever
+ *          read, so any number of simulations, on any threads, can replay
+ *          the same trace at once, each through its own source.
+ *
+ */
+//
+//  Preprocessor Directives  ///////////////////////////////////////////////////
+//
+#ifndef TRACE_ARRIVAL_SOURCE_CPP_
+#define TRACE_ARRIVAL_SOURCE_CPP_
+//
+//  Header Files  //////////////////////////////////////////////////////////////
+//
+#include "TraceArrivalSource.h"
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Starts at the front of the trace
+ *
+ * @param[in] trace_ptr
+ *            Customers, sorted by arrival time
+ *
+ */
+TraceArrivalSource::TraceArrivalSource(std::shared_ptr< const std::vector< Customer > > trace_ptr)
+    : trace_ptr_(trace_ptr), cursor_(0) {}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Destructor
+ *
+ */
+TraceArrivalSource::~TraceArrivalSource() {}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Copies the customer under the cursor and advances
+ *
+ * @param[out] customer
+ *             Assigned the next arrival
+ *
+ * @return Boolean value indicating whether an arrival was left
+ *
+ */
+bool TraceArrivalSource::next(Customer& customer)
+{
+    // Exhausted?
+    if (cursor_ == trace_ptr_->size())
+    {
+        // None left.
+        return false;
+    }
+
+    // Take and advance.
+    customer = (*trace_ptr_)[cursor_++];
+
+    // Taken.
+    return true;
+}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Returns the arrival time of the customer under the cursor
+ *
+ * @param[out] time
+ *             Assigned the next arrival time
+ *
+ * @return Boolean value indicating whether an arrival is left
+ *
+ */
+bool TraceArrivalSource::peek_time(unsigned int& time)
+{
+    // Exhausted?
+    if (cursor_ == trace_ptr_->size())
+    {
+        // None left.
+        return false;
+    }
+
+    // Peek.
+    time = (*trace_ptr_)[cursor_].arrival_time();
+
+    // Available.
+    return true;
+}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Returns number of customers not yet taken
+ *
+ * @return Number of customers not yet taken
+ *
+ */
+size_t TraceArrivalSource::size_hint() const
+{
+    // Return remaining.
+    return trace_ptr_->size() - cursor_;
+}
+//
+//  Terminating Precompiler Directives  ////////////////////////////////////////
+//
+#endif // TRACE_ARRIVAL_SOURCE_CPP_
+//
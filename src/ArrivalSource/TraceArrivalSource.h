@@ -0,0 +1,48 @@
+/**
+ *
+ * @file TraceArrivalSource.h
+ *
+ * @brief Arrival source reading a shared, read-only trace of customers
+ *
+ * @author Josh Wiley
+ *
+ * @details Defines the TraceArrivalSource class
+ *
+ */
+//
+//  Preprocessor Directives  ///////////////////////////////////////////////////
+//
+#ifndef TRACE_ARRIVAL_SOURCE_H_
+#define TRACE_ARRIVAL_SOURCE_H_
+//
+//  Header Files  //////////////////////////////////////////////////////////////
+//
+#include <vector>
+#include <memory>
+#include "ArrivalSource.h"
+//
+//  Class Definition  //////////////////////////////////////////////////////////
+//
+class TraceArrivalSource final : public ArrivalSource
+{
+
+// Public members.
+public:
+    TraceArrivalSource(std::shared_ptr< const std::vector< Customer > >); /**< Parameterized constructor */
+    ~TraceArrivalSource(); /**< Destructor */
+
+    bool next(Customer&) override; /**< Takes the next arrival into the out parameter, returns boolean indicating one was left */
+    bool peek_time(unsigned int&) override; /**< Returns the next arrival time via out parameter without taking it, returns boolean indicating one is left */
+    size_t size_hint() const override; /**< Returns number of arrivals left */
+
+// Private members.
+private:
+    std::shared_ptr< const std::vector< Customer > > trace_ptr_; /**< Customers, sorted by arrival time (shared, never modified) */
+    size_t cursor_; /**< Index of the next customer */
+
+};
+//
+//  Terminating Precompiler Directives  ////////////////////////////////////////
+//
+#endif // TRACE_ARRIVAL_SOURCE_H_
+//
@@ -0,0 +1,158 @@
+/**
+ *
+ * @file AliasTable.cpp
+ *
+ * @brief Walker's alias table for O(1) sampling of a discrete distribution
+ *
+ * @author Josh Wiley
+ *
+ * @details Implements the AliasTable class (Vose's construction). Each of
+ *          the n columns holds 1/n of the probability mass, split between
+ *          its own index and one alias, so a draw is one column pick and
+ *          one biased coin, whatever n is.
+ *
+ */
+//
+//  Preprocessor Directives  ///////////////////////////////////////////////////
+//
+#ifndef ALIAS_TABLE_CPP_
+#define ALIAS_TABLE_CPP_
+#define WHOLE_COLUMN ((std::uint64_t) 1 << 32)
+//
+//  Header Files  //////////////////////////////////////////////////////////////
+//
+#include <cmath>
+#include "AliasTable.h"
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Scales the weights so the average is 1, then repeatedly tops up
+ *          a column below 1 from one above 1, which becomes its alias
+ *
+ * @param[in] weights
+ *            Non-negative weights with a positive sum (at most 2^32 of them)
+ *
+ */
+AliasTable::AliasTable(const std::vector< double >& weights)
+    : thresholds_(weights.size(), WHOLE_COLUMN), aliases_(weights.size()), probabilities_(weights.size())
+{
+    // Total weight.
+    auto total = 0.0;
+    for (auto weight : weights)
+    {
+        // Accumulate.
+        total += weight;
+    }
+
+    // Scaled weights, split into columns below and at or above average.
+    auto count = weights.size();
+    auto scaled = std::vector< double >(count);
+    auto small = std::vector< std::uint32_t >();
+    auto large = std::vector< std::uint32_t >();
+    for (auto i = (size_t) 0; i < count; i++)
+    {
+        // Scale.
+        probabilities_[i] = weights[i] / total;
+        scaled[i] = probabilities_[i] * count;
+        aliases_[i] = (std::uint32_t) i;
+
+        // Classify.
+        (scaled[i] < 1.0 ? small : large).push_back((std::uint32_t) i);
+    }
+
+    // Pair each small column with a large one.
+    while (!small.empty() && !large.empty())
+    {
+        // Take one of each.
+        auto lacking = small.back();
+        auto giving = large.back();
+        small.pop_back();
+
+        // Top up from the large column.
+        thresholds_[lacking] = (std::uint64_t) std::llround(scaled[lacking] * WHOLE_COLUMN);
+        aliases_[lacking] = giving;
+        scaled[giving] -= 1.0 - scaled[lacking];
+
+        // Dropped below average?
+        if (scaled[giving] < 1.0)
+        {
+            // Reclassify.
+            large.pop_back();
+            small.push_back(giving);
+        }
+    }
+
+    // Columns left over are full up to rounding (thresholds already whole).
+}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Destructor
+ *
+ */
+AliasTable::~AliasTable() {}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Picks a column from the high 32 bits (multiply-shift, off from
+ *          exact by at most n / 2^32) and flips the column's coin with the
+ *          low 32 bits
+ *
+ * @param[in] bits
+ *            64 random bits
+ *
+ * @return Index of the outcome drawn
+ *
+ */
+size_t AliasTable::index_from(std::uint64_t bits) const
+{
+    // Column.
+    auto column = (size_t) (((bits >> 32) * thresholds_.size()) >> 32);
+
+    // Return own index or alias.
+    return (bits & 0xffffffff) < thresholds_[column] ? column : aliases_[column];
+}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Returns number of outcomes
+ *
+ * @return Number of outcomes
+ *
+ */
+size_t AliasTable::size() const
+{
+    // Return size.
+    return thresholds_.size();
+}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Returns the normalized weight of an outcome
+ *
+ * @param[in] index
+ *            Index of the outcome
+ *
+ * @return Probability of the outcome
+ *
+ */
+double AliasTable::probability(size_t index) const
+{
+    // Return probability.
+    return probabilities_[index];
+}
+//
+//  Terminating Precompiler Directives  ////////////////////////////////////////
+//
+#endif // ALIAS_TABLE_CPP_
+//
@@ -0,0 +1,49 @@
+/**
+ *
+ * @file AliasTable.h
+ *
+ * @brief Walker's alias table for O(1) sampling of a discrete distribution
+ *
+ * @author Josh Wiley
+ *
+ * @details Defines the AliasTable class
+ *
+ */
+//
+//  Preprocessor Directives  ///////////////////////////////////////////////////
+//
+#ifndef ALIAS_TABLE_H_
+#define ALIAS_TABLE_H_
+//
+//  Header Files  //////////////////////////////////////////////////////////////
+//
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+//
+//  Class Definition  //////////////////////////////////////////////////////////
+//
+class AliasTable
+{
+
+// Public members.
+public:
+    AliasTable(const std::vector< double >&); /**< Parameterized constructor (weights, not necessarily normalized) */
+    ~AliasTable(); /**< Destructor */
+
+    size_t index_from(std::uint64_t) const; /**< Maps 64 random bits to an index drawn with probability proportional to its weight */
+    size_t size() const; /**< Returns number of outcomes */
+    double probability(size_t) const; /**< Returns the normalized weight of an outcome */
+
+// Private members.
+private:
+    std::vector< std::uint64_t > thresholds_; /**< Chance (in 2^-32 units) that a column keeps its own index rather than its alias */
+    std::vector< std::uint32_t > aliases_; /**< Index each column gives when it does not keep its own */
+    std::vector< double > probabilities_; /**< Normalized weights */
+
+};
+//
+//  Terminating Precompiler Directives  ////////////////////////////////////////
+//
+#endif // ALIAS_TABLE_H_
+//
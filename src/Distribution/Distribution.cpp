@@ -0,0 +1,64 @@
+/**
+ *
+ * @file Distribution.cpp
+ *
+ * @brief Abstract base class for distributions of whole time units
+ *
+ * @author Josh Wiley
+ *
+ * @details Implements the Distribution abstract base class
+ *
+ */
+//
+//  Preprocessor Directives  ///////////////////////////////////////////////////
+//
+#ifndef DISTRIBUTION_CPP_
+#define DISTRIBUTION_CPP_
+//
+//  Header Files  //////////////////////////////////////////////////////////////
+//
+#include <limits>
+#include "Distribution.h"
+//
+//  Static Member Definitions  /////////////////////////////////////////////////
+//
+const size_t Distribution::block_length;
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Destructor
+ *
+ */
+Distribution::~Distribution() {}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Rounds to the nearest whole time unit; values at or beyond the
+ *          largest time (the far tail of a heavy-tailed distribution) give
+ *          the largest time instead of wrapping. Rounding shifts the mean
+ *          noticeably only when it is a few time units, in which case a
+ *          finer time unit is the better fix
+ *
+ * @param[in] value
+ *            Non-negative continuous draw
+ *
+ * @return Draw in whole time units
+ *
+ */
+unsigned int Distribution::to_time(double value)
+{
+    // Largest time.
+    auto largest = std::numeric_limits< unsigned int >::max();
+
+    // Return rounded or saturated.
+    return value < (double) largest ? (unsigned int) (value + 0.5) : largest;
+}
+//
+//  Terminating Precompiler Directives  ////////////////////////////////////////
+//
+#endif // DISTRIBUTION_CPP_
+//
@@ -0,0 +1,45 @@
+/**
+ *
+ * @file Distribution.h
+ *
+ * @brief Abstract base class for distributions of whole time units
+ *
+ * @author Josh Wiley
+ *
+ * @details Defines the Distribution abstract base class
+ *
+ */
+//
+//  Preprocessor Directives  ///////////////////////////////////////////////////
+//
+#ifndef DISTRIBUTION_H_
+#define DISTRIBUTION_H_
+//
+//  Header Files  //////////////////////////////////////////////////////////////
+//
+#include <cstddef>
+#include "../Random/Xoshiro256x4.h"
+//
+//  Class Definition  //////////////////////////////////////////////////////////
+//
+class Distribution
+{
+
+// Public members.
+public:
+    virtual ~Distribution(); /**< Destructor */
+
+    virtual void sample(Xoshiro256x4&, unsigned int*, size_t) const = 0; /**< Fills a buffer with independent draws, in whole time units, using the given generator */
+    virtual double mean() const = 0; /**< Returns the mean of the distribution (before rounding to whole time units) */
+
+// Protected members.
+protected:
+    static const size_t block_length = 256; /**< Number of values transformed per batch of random draws */
+
+    static unsigned int to_time(double); /**< Rounds a non-negative value to the nearest whole time unit, saturating at the largest time */
+};
+//
+//  Terminating Precompiler Directives  ////////////////////////////////////////
+//
+#endif // DISTRIBUTION_H_
+//
@@ -0,0 +1,156 @@
+/**
+ *
+ * @file EmpiricalDistribution.cpp
+ *
+ * @brief Empirical distribution of observed whole time units
+ *
+ * @author Josh Wiley
+ *
+ * @details Implements the EmpiricalDistribution class. The observed CDF is a
+ *          step function over the distinct values, so instead of searching
+ *          it per draw, the steps go into an alias table and each draw is
+ *          one table lookup.
+ *
+ */
+//
+//  Preprocessor Directives  ///////////////////////////////////////////////////
+//
+#ifndef EMPIRICAL_DISTRIBUTION_CPP_
+#define EMPIRICAL_DISTRIBUTION_CPP_
+//
+//  Header Files  //////////////////////////////////////////////////////////////
+//
+#include <algorithm>
+#include "EmpiricalDistribution.h"
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Parameterized constructor
+ *
+ * @param[in] values
+ *            Possible values (a histogram's bins, for instance)
+ *
+ * @param[in] weights
+ *            Relative frequency of each value (non-negative, positive sum)
+ *
+ */
+EmpiricalDistribution::EmpiricalDistribution(const std::vector< unsigned int >& values, const std::vector< double >& weights)
+    : values_(values), table_(weights) {}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Destructor
+ *
+ */
+EmpiricalDistribution::~EmpiricalDistribution() {}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Draws a block of random bits and looks each up in the table
+ *
+ * @param[in,out] engine
+ *                Generator to draw from
+ *
+ * @param[out] output
+ *             Buffer receiving the draws
+ *
+ * @param[in] count
+ *            Number of draws
+ *
+ */
+void EmpiricalDistribution::sample(Xoshiro256x4& engine, unsigned int* output, size_t count) const
+{
+    // Random bits.
+    std::uint64_t bits[block_length];
+
+    // Blocks.
+    for (auto done = (size_t) 0; done < count; )
+    {
+        // Draw.
+        auto length = std::min(block_length, count - done);
+        engine.fill(bits, length);
+
+        // Look up.
+        for (auto i = (size_t) 0; i < length; i++)
+        {
+            // Map.
+            output[done + i] = values_[table_.index_from(bits[i])];
+        }
+
+        // Advance.
+        done += length;
+    }
+}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Returns the values weighted by probability
+ *
+ * @return Mean of the distribution
+ *
+ */
+double EmpiricalDistribution::mean() const
+{
+    // Weighted sum.
+    auto mean = 0.0;
+    for (auto i = (size_t) 0; i < values_.size(); i++)
+    {
+        // Accumulate.
+        mean += table_.probability(i) * values_[i];
+    }
+
+    // Return.
+    return mean;
+}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Sorts the sample and weights each distinct value by the length
+ *          of its run
+ *
+ * @param[in] observations
+ *            Observed values (at least one)
+ *
+ * @return Distribution resampling the observations
+ *
+ */
+EmpiricalDistribution EmpiricalDistribution::from_observations(std::vector< unsigned int > observations)
+{
+    // Group equal values.
+    std::sort(observations.begin(), observations.end());
+
+    // Distinct values and counts.
+    auto values = std::vector< unsigned int >();
+    auto counts = std::vector< double >();
+    for (auto observation : observations)
+    {
+        // New value?
+        if (values.empty() || values.back() != observation)
+        {
+            // Start run.
+            values.push_back(observation);
+            counts.push_back(0.0);
+        }
+
+        // Count.
+        counts.back() += 1.0;
+    }
+
+    // Return.
+    return EmpiricalDistribution(values, counts);
+}
+//
+//  Terminating Precompiler Directives  ////////////////////////////////////////
+//
+#endif // EMPIRICAL_DISTRIBUTION_CPP_
+//
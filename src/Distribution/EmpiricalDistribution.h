@@ -0,0 +1,49 @@
+/**
+ *
+ * @file EmpiricalDistribution.h
+ *
+ * @brief Empirical distribution of observed whole time units
+ *
+ * @author Josh Wiley
+ *
+ * @details Defines the EmpiricalDistribution class
+ *
+ */
+//
+//  Preprocessor Directives  ///////////////////////////////////////////////////
+//
+#ifndef EMPIRICAL_DISTRIBUTION_H_
+#define EMPIRICAL_DISTRIBUTION_H_
+//
+//  Header Files  //////////////////////////////////////////////////////////////
+//
+#include <vector>
+#include "Distribution.h"
+#include "AliasTable.h"
+//
+//  Class Definition  //////////////////////////////////////////////////////////
+//
+class EmpiricalDistribution final : public Distribution
+{
+
+// Public members.
+public:
+    EmpiricalDistribution(const std::vector< unsigned int >&, const std::vector< double >&); /**< Parameterized constructor (values, relative frequency of each) */
+    ~EmpiricalDistribution(); /**< Destructor */
+
+    void sample(Xoshiro256x4&, unsigned int*, size_t) const override; /**< Fills a buffer with independent draws using the given generator */
+    double mean() const override; /**< Returns the mean of the distribution */
+
+    static EmpiricalDistribution from_observations(std::vector< unsigned int >); /**< Returns the distribution of a sample (each distinct value weighted by its count) */
+
+// Private members.
+private:
+    std::vector< unsigned int > values_; /**< Possible values */
+    AliasTable table_; /**< Index of the value given by each draw */
+
+};
+//
+//  Terminating Precompiler Directives  ////////////////////////////////////////
+//
+#endif // EMPIRICAL_DISTRIBUTION_H_
+//
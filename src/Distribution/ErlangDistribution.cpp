@@ -0,0 +1,131 @@
+/**
+ *
+ * @file ErlangDistribution.cpp
+ *
+ * @brief Erlang-k distribution, rounded to whole time units
+ *
+ * @author Josh Wiley
+ *
+ * @details Implements the ErlangDistribution class. A draw is the sum of k
+ *          exponential phases, computed as one logarithm of the product of
+ *          k uniforms rather than k logarithms.
+ *
+ */
+//
+//  Preprocessor Directives  ///////////////////////////////////////////////////
+//
+#ifndef ERLANG_DISTRIBUTION_CPP_
+#define ERLANG_DISTRIBUTION_CPP_
+#define PRODUCT_FLOOR 1e-280
+//
+//  Header Files  //////////////////////////////////////////////////////////////
+//
+#include <cmath>
+#include <algorithm>
+#include "ErlangDistribution.h"
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Parameterized constructor
+ *
+ * @param[in] phases
+ *            Number of exponential phases (k, at least 1)
+ *
+ * @param[in] mean
+ *            Mean of the whole (positive)
+ *
+ */
+ErlangDistribution::ErlangDistribution(unsigned int phases, double mean)
+    : phases_(phases), phase_mean_(mean / phases) {}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Destructor
+ *
+ */
+ErlangDistribution::~ErlangDistribution() {}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Draws uniforms in blocks and takes k per value; the running
+ *          product is folded into a sum of logarithms whenever it nears
+ *          underflow, so any k is safe
+ *
+ * @param[in,out] engine
+ *                Generator to draw from
+ *
+ * @param[out] output
+ *             Buffer receiving the draws
+ *
+ * @param[in] count
+ *            Number of draws
+ *
+ */
+void ErlangDistribution::sample(Xoshiro256x4& engine, unsigned int* output, size_t count) const
+{
+    // Uniforms, and how many are still to be drawn.
+    double units[block_length];
+    auto left = count * phases_;
+    auto available = (size_t) 0;
+    auto next = (size_t) 0;
+
+    // Values.
+    for (auto i = (size_t) 0; i < count; i++)
+    {
+        // Product of the phases' uniforms.
+        auto product = 1.0;
+        auto log_sum = 0.0;
+        for (auto phase = (unsigned int) 0; phase < phases_; phase++)
+        {
+            // Block used up?
+            if (next == available)
+            {
+                // Draw.
+                available = std::min(block_length, left);
+                engine.fill_unit(units, available);
+                left -= available;
+                next = 0;
+            }
+
+            // Multiply (1 - u is in (0, 1]).
+            product *= 1.0 - units[next++];
+
+            // Near underflow?
+            if (product < PRODUCT_FLOOR)
+            {
+                // Fold.
+                log_sum += std::log(product);
+                product = 1.0;
+            }
+        }
+
+        // Sum of the phases.
+        output[i] = to_time(-phase_mean_ * (log_sum + std::log(product)));
+    }
+}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Returns the mean of the distribution
+ *
+ * @return Mean of the distribution
+ *
+ */
+double ErlangDistribution::mean() const
+{
+    // Return mean.
+    return phase_mean_ * phases_;
+}
+//
+//  Terminating Precompiler Directives  ////////////////////////////////////////
+//
+#endif // ERLANG_DISTRIBUTION_CPP_
+//
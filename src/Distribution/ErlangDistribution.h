@@ -0,0 +1,45 @@
+/**
+ *
+ * @file ErlangDistribution.h
+ *
+ * @brief Erlang-k distribution, rounded to whole time units
+ *
+ * @author Josh Wiley
+ *
+ * @details Defines the ErlangDistribution class
+ *
+ */
+//
+//  Preprocessor Directives  ///////////////////////////////////////////////////
+//
+#ifndef ERLANG_DISTRIBUTION_H_
+#define ERLANG_DISTRIBUTION_H_
+//
+//  Header Files  //////////////////////////////////////////////////////////////
+//
+#include "Distribution.h"
+//
+//  Class Definition  //////////////////////////////////////////////////////////
+//
+class ErlangDistribution final : public Distribution
+{
+
+// Public members.
+public:
+    ErlangDistribution(unsigned int, double); /**< Parameterized constructor (number of phases k, mean of the whole) */
+    ~ErlangDistribution(); /**< Destructor */
+
+    void sample(Xoshiro256x4&, unsigned int*, size_t) const override; /**< Fills a buffer with independent draws using the given generator */
+    double mean() const override; /**< Returns the mean of the distribution */
+
+// Private members.
+private:
+    unsigned int phases_; /**< Number of exponential phases (k) */
+    double phase_mean_; /**< Mean of each phase (mean / k) */
+
+};
+//
+//  Terminating Precompiler Directives  ////////////////////////////////////////
+//
+#endif // ERLANG_DISTRIBUTION_H_
+//
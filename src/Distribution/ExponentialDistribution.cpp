@@ -0,0 +1,105 @@
+/**
+ *
+ * @file ExponentialDistribution.cpp
+ *
+ * @brief Exponential distribution, rounded to whole time units
+ *
+ * @author Josh Wiley
+ *
+ * @details Implements the ExponentialDistribution class
+ *
+ */
+//
+//  Preprocessor Directives  ///////////////////////////////////////////////////
+//
+#ifndef EXPONENTIAL_DISTRIBUTION_CPP_
+#define EXPONENTIAL_DISTRIBUTION_CPP_
+//
+//  Header Files  //////////////////////////////////////////////////////////////
+//
+#include <cmath>
+#include <algorithm>
+#include "ExponentialDistribution.h"
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Parameterized constructor
+ *
+ * @param[in] mean
+ *            Mean (positive)
+ *
+ */
+ExponentialDistribution::ExponentialDistribution(double mean)
+    : mean_(mean) {}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Destructor
+ *
+ */
+ExponentialDistribution::~ExponentialDistribution() {}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Draws uniforms in blocks and inverts the CDF of each
+ *          (-mean * ln(1 - u))
+ *
+ * @param[in,out] engine
+ *                Generator to draw from
+ *
+ * @param[out] output
+ *             Buffer receiving the draws
+ *
+ * @param[in] count
+ *            Number of draws
+ *
+ */
+void ExponentialDistribution::sample(Xoshiro256x4& engine, unsigned int* output, size_t count) const
+{
+    // Uniforms.
+    double units[block_length];
+
+    // Blocks.
+    for (auto done = (size_t) 0; done < count; )
+    {
+        // Draw.
+        auto length = std::min(block_length, count - done);
+        engine.fill_unit(units, length);
+
+        // Invert (1 - u is in (0, 1]).
+        for (auto i = (size_t) 0; i < length; i++)
+        {
+            // Map.
+            output[done + i] = to_time(-mean_ * std::log(1.0 - units[i]));
+        }
+
+        // Advance.
+        done += length;
+    }
+}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Returns the mean of the distribution
+ *
+ * @return Mean of the distribution
+ *
+ */
+double ExponentialDistribution::mean() const
+{
+    // Return mean.
+    return mean_;
+}
+//
+//  Terminating Precompiler Directives  ////////////////////////////////////////
+//
+#endif // EXPONENTIAL_DISTRIBUTION_CPP_
+//
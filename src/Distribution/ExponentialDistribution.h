@@ -0,0 +1,44 @@
+/**
+ *
+ * @file ExponentialDistribution.h
+ *
+ * @brief Exponential distribution, rounded to whole time units
+ *
+ * @author Josh Wiley
+ *
+ * @details Defines the ExponentialDistribution class
+ *
+ */
+//
+//  Preprocessor Directives  ///////////////////////////////////////////////////
+//
+#ifndef EXPONENTIAL_DISTRIBUTION_H_
+#define EXPONENTIAL_DISTRIBUTION_H_
+//
+//  Header Files  //////////////////////////////////////////////////////////////
+//
+#include "Distribution.h"
+//
+//  Class Definition  //////////////////////////////////////////////////////////
+//
+class ExponentialDistribution final : public Distribution
+{
+
+// Public members.
+public:
+    ExponentialDistribution(double); /**< Parameterized constructor (mean) */
+    ~ExponentialDistribution(); /**< Destructor */
+
+    void sample(Xoshiro256x4&, unsigned int*, size_t) const override; /**< Fills a buffer with independent draws using the given generator */
+    double mean() const override; /**< Returns the mean of the distribution */
+
+// Private members.
+private:
+    double mean_; /**< Mean (1 / rate) */
+
+};
+//
+//  Terminating Precompiler Directives  ////////////////////////////////////////
+//
+#endif // EXPONENTIAL_DISTRIBUTION_H_
+//
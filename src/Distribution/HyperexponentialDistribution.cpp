@@ -0,0 +1,122 @@
+/**
+ *
+ * @file HyperexponentialDistribution.cpp
+ *
+ * @brief Hyperexponential distribution (mixture of exponentials), rounded to
+ *        whole time units
+ *
+ * @author Josh Wiley
+ *
+ * @details Implements the HyperexponentialDistribution class. Each draw
+ *          picks a branch from an alias table and then inverts that
+ *          branch's exponential CDF, so a mostly-quick, occasionally-long
+ *          mix of transactions costs the same per draw as one exponential.
+ *
+ */
+//
+//  Preprocessor Directives  ///////////////////////////////////////////////////
+//
+#ifndef HYPEREXPONENTIAL_DISTRIBUTION_CPP_
+#define HYPEREXPONENTIAL_DISTRIBUTION_CPP_
+//
+//  Header Files  //////////////////////////////////////////////////////////////
+//
+#include <cmath>
+#include <algorithm>
+#include "HyperexponentialDistribution.h"
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Parameterized constructor
+ *
+ * @param[in] weights
+ *            Relative chance of each branch (non-negative, positive sum)
+ *
+ * @param[in] means
+ *            Mean of each branch (positive, one per weight)
+ *
+ */
+HyperexponentialDistribution::HyperexponentialDistribution(const std::vector< double >& weights, const std::vector< double >& means)
+    : branches_(weights), means_(means) {}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Destructor
+ *
+ */
+HyperexponentialDistribution::~HyperexponentialDistribution() {}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Draws a block of branch picks and a block of uniforms, then
+ *          scales each exponential by its branch's mean
+ *
+ * @param[in,out] engine
+ *                Generator to draw from
+ *
+ * @param[out] output
+ *             Buffer receiving the draws
+ *
+ * @param[in] count
+ *            Number of draws
+ *
+ */
+void HyperexponentialDistribution::sample(Xoshiro256x4& engine, unsigned int* output, size_t count) const
+{
+    // Branch bits and uniforms.
+    std::uint64_t bits[block_length];
+    double units[block_length];
+
+    // Blocks.
+    for (auto done = (size_t) 0; done < count; )
+    {
+        // Draw.
+        auto length = std::min(block_length, count - done);
+        engine.fill(bits, length);
+        engine.fill_unit(units, length);
+
+        // Pick branch and invert (1 - u is in (0, 1]).
+        for (auto i = (size_t) 0; i < length; i++)
+        {
+            // Map.
+            output[done + i] = to_time(-means_[branches_.index_from(bits[i])] * std::log(1.0 - units[i]));
+        }
+
+        // Advance.
+        done += length;
+    }
+}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Returns the branch means weighted by branch probability
+ *
+ * @return Mean of the distribution
+ *
+ */
+double HyperexponentialDistribution::mean() const
+{
+    // Weighted sum.
+    auto mean = 0.0;
+    for (auto i = (size_t) 0; i < means_.size(); i++)
+    {
+        // Accumulate.
+        mean += branches_.probability(i) * means_[i];
+    }
+
+    // Return.
+    return mean;
+}
+//
+//  Terminating Precompiler Directives  ////////////////////////////////////////
+//
+#endif // HYPEREXPONENTIAL_DISTRIBUTION_CPP_
+//
@@ -0,0 +1,48 @@
+/**
+ *
+ * @file HyperexponentialDistribution.h
+ *
+ * @brief Hyperexponential distribution (mixture of exponentials), rounded to
+ *        whole time units
+ *
+ * @author Josh Wiley
+ *
+ * @details Defines the HyperexponentialDistribution class
+ *
+ */
+//
+//  Preprocessor Directives  ///////////////////////////////////////////////////
+//
+#ifndef HYPEREXPONENTIAL_DISTRIBUTION_H_
+#define HYPEREXPONENTIAL_DISTRIBUTION_H_
+//
+//  Header Files  //////////////////////////////////////////////////////////////
+//
+#include <vector>
+#include "Distribution.h"
+#include "AliasTable.h"
+//
+//  Class Definition  //////////////////////////////////////////////////////////
+//
+class HyperexponentialDistribution final : public Distribution
+{
+
+// Public members.
+public:
+    HyperexponentialDistribution(const std::vector< double >&, const std::vector< double >&); /**< Parameterized constructor (branch weights, branch means) */
+    ~HyperexponentialDistribution(); /**< Destructor */
+
+    void sample(Xoshiro256x4&, unsigned int*, size_t) const override; /**< Fills a buffer with independent draws using the given generator */
+    double mean() const override; /**< Returns the mean of the distribution */
+
+// Private members.
+private:
+    AliasTable branches_; /**< Branch chosen for each draw */
+    std::vector< double > means_; /**< Mean of each branch's exponential */
+
+};
+//
+//  Terminating Precompiler Directives  ////////////////////////////////////////
+//
+#endif // HYPEREXPONENTIAL_DISTRIBUTION_H_
+//
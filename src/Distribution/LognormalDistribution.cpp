@@ -0,0 +1,149 @@
+/**
+ *
+ * @file LognormalDistribution.cpp
+ *
+ * @brief Lognormal distribution, rounded to whole time units
+ *
+ * @author Josh Wiley
+ *
+ * @details Implements the LognormalDistribution class. Normals come in pairs
+ *          from the Box-Muller transform of a block of uniforms.
+ *
+ */
+//
+//  Preprocessor Directives  ///////////////////////////////////////////////////
+//
+#ifndef LOGNORMAL_DISTRIBUTION_CPP_
+#define LOGNORMAL_DISTRIBUTION_CPP_
+#define TWO_PI 6.283185307179586
+//
+//  Header Files  //////////////////////////////////////////////////////////////
+//
+#include <cmath>
+#include <algorithm>
+#include "LognormalDistribution.h"
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Parameterized constructor
+ *
+ * @param[in] mu
+ *            Mean of the underlying normal (log of the median)
+ *
+ * @param[in] sigma
+ *            Standard deviation of the underlying normal (non-negative)
+ *
+ */
+LognormalDistribution::LognormalDistribution(double mu, double sigma)
+    : mu_(mu), sigma_(sigma) {}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Destructor
+ *
+ */
+LognormalDistribution::~LognormalDistribution() {}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Draws uniforms in blocks, turns each pair into two standard
+ *          normals (Box-Muller), and exponentiates mu + sigma * z (an odd
+ *          count discards the last normal)
+ *
+ * @param[in,out] engine
+ *                Generator to draw from
+ *
+ * @param[out] output
+ *             Buffer receiving the draws
+ *
+ * @param[in] count
+ *            Number of draws
+ *
+ */
+void LognormalDistribution::sample(Xoshiro256x4& engine, unsigned int* output, size_t count) const
+{
+    // Uniforms (one pair per two values).
+    double units[block_length];
+
+    // Blocks.
+    for (auto done = (size_t) 0; done < count; )
+    {
+        // Draw pairs.
+        auto length = std::min(block_length, count - done);
+        auto pairs = (length + 1) / 2;
+        engine.fill_unit(units, 2 * pairs);
+
+        // Transform.
+        for (auto p = (size_t) 0; p < pairs; p++)
+        {
+            // Radius (1 - u is in (0, 1]) and angle.
+            auto radius = sigma_ * std::sqrt(-2.0 * std::log(1.0 - units[2 * p]));
+            auto angle = TWO_PI * units[2 * p + 1];
+
+            // First of the pair.
+            output[done + 2 * p] = to_time(std::exp(mu_ + radius * std::cos(angle)));
+
+            // Second, if wanted.
+            if (2 * p + 1 < length)
+            {
+                // Map.
+                output[done + 2 * p + 1] = to_time(std::exp(mu_ + radius * std::sin(angle)));
+            }
+        }
+
+        // Advance.
+        done += length;
+    }
+}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Returns exp(mu + sigma^2 / 2)
+ *
+ * @return Mean of the distribution
+ *
+ */
+double LognormalDistribution::mean() const
+{
+    // Return mean.
+    return std::exp(mu_ + sigma_ * sigma_ / 2.0);
+}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Solves for the underlying normal from the moments most easily
+ *          read off transaction logs: sigma^2 = ln(1 + cv^2) and
+ *          mu = ln(mean) - sigma^2 / 2
+ *
+ * @param[in] mean
+ *            Mean (positive)
+ *
+ * @param[in] cv
+ *            Coefficient of variation (standard deviation / mean)
+ *
+ * @return Distribution with the given moments
+ *
+ */
+LognormalDistribution LognormalDistribution::from_moments(double mean, double cv)
+{
+    // Variance of the underlying normal.
+    auto variance = std::log(1.0 + cv * cv);
+
+    // Return.
+    return LognormalDistribution(std::log(mean) - variance / 2.0, std::sqrt(variance));
+}
+//
+//  Terminating Precompiler Directives  ////////////////////////////////////////
+//
+#endif // LOGNORMAL_DISTRIBUTION_CPP_
+//
@@ -0,0 +1,47 @@
+/**
+ *
+ * @file LognormalDistribution.h
+ *
+ * @brief Lognormal distribution, rounded to whole time units
+ *
+ * @author Josh Wiley
+ *
+ * @details Defines the LognormalDistribution class
+ *
+ */
+//
+//  Preprocessor Directives  ///////////////////////////////////////////////////
+//
+#ifndef LOGNORMAL_DISTRIBUTION_H_
+#define LOGNORMAL_DISTRIBUTION_H_
+//
+//  Header Files  //////////////////////////////////////////////////////////////
+//
+#include "Distribution.h"
+//
+//  Class Definition  //////////////////////////////////////////////////////////
+//
+class LognormalDistribution final : public Distribution
+{
+
+// Public members.
+public:
+    LognormalDistribution(double, double); /**< Parameterized constructor (mean and standard deviation of the underlying normal) */
+    ~LognormalDistribution(); /**< Destructor */
+
+    void sample(Xoshiro256x4&, unsigned int*, size_t) const override; /**< Fills a buffer with independent draws using the given generator */
+    double mean() const override; /**< Returns the mean of the distribution */
+
+    static LognormalDistribution from_moments(double, double); /**< Returns the distribution with the given mean and coefficient of variation */
+
+// Private members.
+private:
+    double mu_; /**< Mean of the underlying normal */
+    double sigma_; /**< Standard deviation of the underlying normal */
+
+};
+//
+//  Terminating Precompiler Directives  ////////////////////////////////////////
+//
+#endif // LOGNORMAL_DISTRIBUTION_H_
+//
@@ -0,0 +1,87 @@
+/**
+ *
+ * @file UniformDistribution.cpp
+ *
+ * @brief Discrete uniform distribution over a range of whole time units
+ *
+ * @author Josh Wiley
+ *
+ * @details Implements the UniformDistribution class
+ *
+ */
+//
+//  Preprocessor Directives  ///////////////////////////////////////////////////
+//
+#ifndef UNIFORM_DISTRIBUTION_CPP_
+#define UNIFORM_DISTRIBUTION_CPP_
+//
+//  Header Files  //////////////////////////////////////////////////////////////
+//
+#include "UniformDistribution.h"
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Parameterized constructor
+ *
+ * @param[in] min
+ *            Smallest value
+ *
+ * @param[in] max
+ *            Largest value (at least min)
+ *
+ */
+UniformDistribution::UniformDistribution(unsigned int min, unsigned int max)
+    : min_(min), max_(max) {}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Destructor
+ *
+ */
+UniformDistribution::~UniformDistribution() {}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Fills the buffer with the generator's unbiased bounded draws
+ *
+ * @param[in,out] engine
+ *                Generator to draw from
+ *
+ * @param[out] output
+ *             Buffer receiving the draws
+ *
+ * @param[in] count
+ *            Number of draws
+ *
+ */
+void UniformDistribution::sample(Xoshiro256x4& engine, unsigned int* output, size_t count) const
+{
+    // Draw.
+    engine.fill_uniform(output, count, min_, max_);
+}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Returns the midpoint of the range
+ *
+ * @return Mean of the distribution
+ *
+ */
+double UniformDistribution::mean() const
+{
+    // Return midpoint.
+    return ((double) min_ + (double) max_) / 2.0;
+}
+//
+//  Terminating Precompiler Directives  ////////////////////////////////////////
+//
+#endif // UNIFORM_DISTRIBUTION_CPP_
+//
@@ -0,0 +1,45 @@
+/**
+ *
+ * @file UniformDistribution.h
+ *
+ * @brief Discrete uniform distribution over a range of whole time units
+ *
+ * @author Josh Wiley
+ *
+ * @details Defines the UniformDistribution class
+ *
+ */
+//
+//  Preprocessor Directives  ///////////////////////////////////////////////////
+//
+#ifndef UNIFORM_DISTRIBUTION_H_
+#define UNIFORM_DISTRIBUTION_H_
+//
+//  Header Files  //////////////////////////////////////////////////////////////
+//
+#include "Distribution.h"
+//
+//  Class Definition  //////////////////////////////////////////////////////////
+//
+class UniformDistribution final : public Distribution
+{
+
+// Public members.
+public:
+    UniformDistribution(unsigned int, unsigned int); /**< Parameterized constructor (minimum and maximum, inclusive) */
+    ~UniformDistribution(); /**< Destructor */
+
+    void sample(Xoshiro256x4&, unsigned int*, size_t) const override; /**< Fills a buffer with independent draws using the given generator */
+    double mean() const override; /**< Returns the mean of the distribution */
+
+// Private members.
+private:
+    unsigned int min_; /**< Smallest value */
+    unsigned int max_; /**< Largest value */
+
+};
+//
+//  Terminating Precompiler Directives  ////////////////////////////////////////
+//
+#endif // UNIFORM_DISTRIBUTION_H_
+//
@@ -0,0 +1,237 @@
+/**
+ *
+ * @file DynamicBitset.cpp
+ *
+ * @brief Fixed-size bitset with a run-time length and a cached population
+ *        count
+ *
+ * @author Josh Wiley
+ *
+ * @details Implements the DynamicBitset class
+ *
+ */
+//
+//  Preprocessor Directives  ///////////////////////////////////////////////////
+//
+#ifndef DYNAMIC_BITSET_CPP_
+#define DYNAMIC_BITSET_CPP_
+//
+//  Header Files  //////////////////////////////////////////////////////////////
+//
+#include "DynamicBitset.h"
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Allocates words for the bits and initializes every bit to value
+ *
+ * @param[in] size
+ *            Number of bits
+ *
+ * @param[in] value
+ *            Initial value of every bit
+ *
+ * @param[in] arena_ptr
+ *            Arena to allocate from, or null to use the global heap
+ *
+ */
+DynamicBitset::DynamicBitset(size_t size, bool value, std::shared_ptr< Arena > arena_ptr)
+    : words_(
+          (size + word_bits_ - 1) / word_bits_,
+          value ? ~std::uint64_t(0) : 0,
+          ArenaAllocator< std::uint64_t >(arena_ptr)
+      ),
+      size_(size), count_(value ? size : 0)
+{
+    // Clear padding bits past the end (keeps find_first in range).
+    if (value && size_ % word_bits_ != 0)
+    {
+        // Mask last word.
+        words_.back() = (std::uint64_t(1) << (size_ % word_bits_)) - 1;
+    }
+}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Copy-initializes bitset from another bitset
+ *
+ */
+DynamicBitset::DynamicBitset(const DynamicBitset& origin)
+    : words_(origin.words_), size_(origin.size_), count_(origin.count_) {}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Destructor
+ *
+ */
+DynamicBitset::~DynamicBitset() {}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Returns number of bits
+ *
+ * @return Number of bits
+ *
+ */
+size_t DynamicBitset::size() const
+{
+    // Return size.
+    return size_;
+}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Returns number of set bits (kept up to date by set and reset)
+ *
+ * @return Number of set bits
+ *
+ */
+size_t DynamicBitset::count() const
+{
+    // Return count.
+    return count_;
+}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Returns a boolean indicating whether every bit is set
+ *
+ * @return Boolean value indicating whether every bit is set
+ *
+ */
+bool DynamicBitset::all() const
+{
+    // Compare count.
+    return count_ == size_;
+}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Returns a boolean indicating whether no bit is set
+ *
+ * @return Boolean value indicating whether no bit is set
+ *
+ */
+bool DynamicBitset::none() const
+{
+    // Compare count.
+    return count_ == 0;
+}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Returns value of a bit
+ *
+ * @param[in] index
+ *            Index of the bit
+ *
+ * @return Boolean value of the bit
+ *
+ */
+bool DynamicBitset::test(size_t index) const
+{
+    // Return bit.
+    return (words_[index / word_bits_] >> (index % word_bits_)) & 1;
+}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Sets a bit
+ *
+ * @param[in] index
+ *            Index of the bit
+ *
+ */
+void DynamicBitset::set(size_t index)
+{
+    // Already set?
+    if (test(index))
+    {
+        // Return.
+        return;
+    }
+
+    // Set and count.
+    words_[index / word_bits_] |= std::uint64_t(1) << (index % word_bits_);
+    count_++;
+}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Clears a bit
+ *
+ * @param[in] index
+ *            Index of the bit
+ *
+ */
+void DynamicBitset::reset(size_t index)
+{
+    // Already clear?
+    if (!test(index))
+    {
+        // Return.
+        return;
+    }
+
+    // Clear and count.
+    words_[index / word_bits_] &= ~(std::uint64_t(1) << (index % word_bits_));
+    count_--;
+}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Returns the index of the lowest set bit, skipping empty words and
+ *          using a count-trailing-zeros instruction on the first non-empty one
+ *
+ * @return Index of the lowest set bit, or size() if no bit is set
+ *
+ */
+size_t DynamicBitset::find_first() const
+{
+    // Nothing set?
+    if (count_ == 0)
+    {
+        // Return end.
+        return size_;
+    }
+
+    // Find first non-empty word.
+    for (auto i = (size_t) 0; i < words_.size(); i++)
+    {
+        // Non-empty?
+        if (words_[i] != 0)
+        {
+            // Return bit index.
+            return i * word_bits_ + __builtin_ctzll(words_[i]);
+        }
+    }
+
+    // Return end.
+    return size_;
+}
+//
+//  Terminating Precompiler Directives  ////////////////////////////////////////
+//
+#endif // DYNAMIC_BITSET_CPP_
+//
@@ -0,0 +1,64 @@
+/**
+ *
+ * @file DynamicBitset.h
+ *
+ * @brief Fixed-size bitset with a run-time length and a cached population
+ *        count
+ *
+ * @author Josh Wiley
+ *
+ * @details Defines the DynamicBitset class
+ *
+ */
+//
+//  Preprocessor Directives  ///////////////////////////////////////////////////
+//
+#ifndef DYNAMIC_BITSET_H_
+#define DYNAMIC_BITSET_H_
+//
+//  Header Files  //////////////////////////////////////////////////////////////
+//
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include <memory>
+#include "../Arena/ArenaAllocator.h"
+//
+//  Class Definition  //////////////////////////////////////////////////////////
+//
+class DynamicBitset
+{
+
+// Public members.
+public:
+    DynamicBitset(
+        size_t size = 0,
+        bool value = false,
+        std::shared_ptr< Arena > arena_ptr = std::shared_ptr< Arena >(nullptr)
+    ); /**< Parameterized constructor */
+    DynamicBitset(const DynamicBitset&); /**< Copy constructor */
+    ~DynamicBitset(); /**< Destructor */
+
+    size_t size() const; /**< Returns number of bits */
+    size_t count() const; /**< Returns number of set bits */
+    bool all() const; /**< Returns boolean indicating if every bit is set */
+    bool none() const; /**< Returns boolean indicating if no bit is set */
+    bool test(size_t) const; /**< Returns value of bit */
+    void set(size_t); /**< Sets bit */
+    void reset(size_t); /**< Clears bit */
+    size_t find_first() const; /**< Returns index of the lowest set bit, or size() if none are set */
+
+// Private members.
+private:
+    static const size_t word_bits_ = 64; /**< Bits per storage word */
+
+    std::vector< std::uint64_t, ArenaAllocator< std::uint64_t > > words_; /**< Bit storage, lowest index in the lowest bit */
+    size_t size_; /**< Number of bits */
+    size_t count_; /**< Number of set bits */
+
+};
+//
+//  Terminating Precompiler Directives  ////////////////////////////////////////
+//
+#endif // DYNAMIC_BITSET_H_
+//
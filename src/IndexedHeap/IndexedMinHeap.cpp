@@ -0,0 +1,444 @@
+/**
+ *
+ * @file IndexedMinHeap.cpp
+ *
+ * @brief Templated binary min-heap over a dense set of integer indices
+ *
+ * @author Josh Wiley
+ *
+ * @details Implements the IndexedMinHeap class
+ *
+ */
+//
+//  Preprocessor Directives  ///////////////////////////////////////////////////
+//
+#ifndef INDEXED_MIN_HEAP_CPP_
+#define INDEXED_MIN_HEAP_CPP_
+//
+//  Header Files  //////////////////////////////////////////////////////////////
+//
+#include "IndexedMinHeap.h"
+//
+//  Static Member Definitions  /////////////////////////////////////////////////
+//
+template<typename K>
+const size_t IndexedMinHeap<K>::npos_;
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Reserves space for the expected number of indices
+ *
+ * @param[in] capacity
+ *            Number of indices expected to be tracked (the heap grows beyond
+ *            this if needed)
+ *
+ * @param[in] arena_ptr
+ *            Arena to allocate from, or null to use the global heap
+ *
+ */
+template<typename K>
+IndexedMinHeap<K>::IndexedMinHeap(size_t capacity, std::shared_ptr< Arena > arena_ptr)
+    : heap_(ArenaAllocator< size_t >(arena_ptr)),
+      positions_(capacity, npos_, ArenaAllocator< size_t >(arena_ptr)),
+      keys_(capacity, K(), ArenaAllocator< K >(arena_ptr))
+{
+    // Reserve heap slots.
+    heap_.reserve(capacity);
+}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Copy-initializes heap from another heap
+ *
+ */
+template<typename K>
+IndexedMinHeap<K>::IndexedMinHeap(const IndexedMinHeap<K>& origin)
+    : heap_(origin.heap_), positions_(origin.positions_), keys_(origin.keys_) {}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Destructor
+ *
+ */
+template<typename K>
+IndexedMinHeap<K>::~IndexedMinHeap() {}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Returns a boolean indicating whether or not the heap is empty
+ *
+ * @return Boolean value indicating whether or not the heap is empty
+ *
+ */
+template<typename K>
+bool IndexedMinHeap<K>::empty() const
+{
+    // Return empty status.
+    return heap_.empty();
+}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Returns number of indices currently in the heap
+ *
+ * @return Number of indices currently in the heap
+ *
+ */
+template<typename K>
+size_t IndexedMinHeap<K>::size() const
+{
+    // Return size.
+    return heap_.size();
+}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Returns a boolean indicating whether or not the index is in the heap
+ *
+ * @param[in] index
+ *            Index to look up
+ *
+ * @return Boolean value indicating whether or not the index is in the heap
+ *
+ */
+template<typename K>
+bool IndexedMinHeap<K>::contains(size_t index) const
+{
+    // Return membership.
+    return index < positions_.size() && positions_[index] != npos_;
+}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Returns the key of an index (only meaningful if the index is in
+ *          the heap)
+ *
+ * @param[in] index
+ *            Index to look up
+ *
+ * @return Key of the index
+ *
+ */
+template<typename K>
+K IndexedMinHeap<K>::key(size_t index) const
+{
+    // Return key.
+    return keys_[index];
+}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Returns the index with the smallest key; ties are broken in favor
+ *          of the smallest index
+ *
+ * @return Index at the top of the heap
+ *
+ */
+template<typename K>
+size_t IndexedMinHeap<K>::top() const
+{
+    // Return top index.
+    return heap_.front();
+}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Returns the smallest key in the heap
+ *
+ * @return Key of the index at the top of the heap
+ *
+ */
+template<typename K>
+K IndexedMinHeap<K>::top_key() const
+{
+    // Return top key.
+    return keys_[heap_.front()];
+}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Returns the runner-up index, which is the better of the root's
+ *          children (requires at least two indices in the heap)
+ *
+ * @return Index that would be at the top of the heap after a pop
+ *
+ */
+template<typename K>
+size_t IndexedMinHeap<K>::second() const
+{
+    // Only one child?
+    if (heap_.size() < 3)
+    {
+        // Return left child.
+        return heap_[1];
+    }
+
+    // Return better child.
+    return precedes(1, 2) ? heap_[1] : heap_[2];
+}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Inserts the index with the given key, or re-keys it in place if it
+ *          is already in the heap
+ *
+ * @param[in] index
+ *            Index to insert or update
+ *
+ * @param[in] new_key
+ *            Key to associate with the index
+ *
+ */
+template<typename K>
+void IndexedMinHeap<K>::update(size_t index, K new_key)
+{
+    // Grow index tables?
+    if (index >= positions_.size())
+    {
+        // Grow.
+        positions_.resize(index + 1, npos_);
+        keys_.resize(index + 1);
+    }
+
+    // Not in heap?
+    if (positions_[index] == npos_)
+    {
+        // Append and restore order.
+        keys_[index] = new_key;
+        positions_[index] = heap_.size();
+        heap_.push_back(index);
+        sift_up(heap_.size() - 1);
+
+        // Return.
+        return;
+    }
+
+    // Save old key and assign new key.
+    auto old_key = keys_[index];
+    keys_[index] = new_key;
+
+    // Restore order in the direction the key moved.
+    if (new_key < old_key)
+    {
+        // Move up.
+        sift_up(positions_[index]);
+    }
+    else
+    {
+        // Move down.
+        sift_down(positions_[index]);
+    }
+}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Removes the index from the heap
+ *
+ * @param[in] index
+ *            Index to remove
+ *
+ * @return Boolean value indicating the success of the operation
+ *
+ */
+template<typename K>
+bool IndexedMinHeap<K>::erase(size_t index)
+{
+    // Not in heap?
+    if (!contains(index))
+    {
+        // Failure.
+        return false;
+    }
+
+    // Move last slot into the vacated slot.
+    auto slot = positions_[index];
+    auto last = heap_.size() - 1;
+    swap_slots(slot, last);
+
+    // Remove.
+    heap_.pop_back();
+    positions_[index] = npos_;
+
+    // Restore order for the moved index.
+    if (slot < heap_.size())
+    {
+        // Fix both directions (only one will move).
+        auto moved = heap_[slot];
+        sift_up(slot);
+        sift_down(positions_[moved]);
+    }
+
+    // Success.
+    return true;
+}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Removes the index at the top of the heap
+ *
+ * @return Boolean value indicating the success of the operation
+ *
+ */
+template<typename K>
+bool IndexedMinHeap<K>::pop()
+{
+    // Empty?
+    if (empty())
+    {
+        // Failure.
+        return false;
+    }
+
+    // Remove top.
+    return erase(heap_.front());
+}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Orders slots by key, then by index so that equal keys always
+ *          resolve to the lowest index
+ *
+ * @return Boolean value indicating if slot a orders before slot b
+ *
+ */
+template<typename K>
+bool IndexedMinHeap<K>::precedes(size_t a, size_t b) const
+{
+    // Indices.
+    auto index_a = heap_[a];
+    auto index_b = heap_[b];
+
+    // Compare keys, then indices.
+    return keys_[index_a] < keys_[index_b] ||
+        (!(keys_[index_b] < keys_[index_a]) && index_a < index_b);
+}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Swaps two heap slots and updates their recorded positions
+ *
+ */
+template<typename K>
+void IndexedMinHeap<K>::swap_slots(size_t a, size_t b)
+{
+    // Swap indices.
+    auto temp = heap_[a];
+    heap_[a] = heap_[b];
+    heap_[b] = temp;
+
+    // Fix positions.
+    positions_[heap_[a]] = a;
+    positions_[heap_[b]] = b;
+}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Moves the slot toward the root until heap order holds
+ *
+ */
+template<typename K>
+void IndexedMinHeap<K>::sift_up(size_t slot)
+{
+    // Climb while before parent.
+    while (slot > 0)
+    {
+        // Parent slot.
+        auto parent = (slot - 1) / 2;
+
+        // In order?
+        if (!precedes(slot, parent))
+        {
+            // Done.
+            return;
+        }
+
+        // Swap and climb.
+        swap_slots(slot, parent);
+        slot = parent;
+    }
+}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Moves the slot toward the leaves until heap order holds
+ *
+ */
+template<typename K>
+void IndexedMinHeap<K>::sift_down(size_t slot)
+{
+    // Size.
+    auto count = heap_.size();
+
+    // Descend while a child orders first.
+    while (true)
+    {
+        // Children.
+        auto left = 2 * slot + 1;
+        auto right = left + 1;
+        auto smallest = slot;
+
+        // Left child first?
+        if (left < count && precedes(left, smallest))
+        {
+            // Select left.
+            smallest = left;
+        }
+
+        // Right child first?
+        if (right < count && precedes(right, smallest))
+        {
+            // Select right.
+            smallest = right;
+        }
+
+        // In order?
+        if (smallest == slot)
+        {
+            // Done.
+            return;
+        }
+
+        // Swap and descend.
+        swap_slots(slot, smallest);
+        slot = smallest;
+    }
+}
+//
+//  Terminating Precompiler Directives  ////////////////////////////////////////
+//
+#endif // INDEXED_MIN_HEAP_CPP_
+//
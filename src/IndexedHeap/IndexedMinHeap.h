@@ -0,0 +1,73 @@
+/**
+ *
+ * @file IndexedMinHeap.h
+ *
+ * @brief Templated binary min-heap over a dense set of integer indices
+ *
+ * @author Josh Wiley
+ *
+ * @details Defines the IndexedMinHeap class
+ *
+ */
+//
+//  Preprocessor Directives  ///////////////////////////////////////////////////
+//
+#ifndef INDEXED_MIN_HEAP_H_
+#define INDEXED_MIN_HEAP_H_
+//
+//  Header Files  //////////////////////////////////////////////////////////////
+//
+#include <cstddef>
+#include <vector>
+#include <memory>
+#include "../Arena/ArenaAllocator.h"
+//
+//  Class Definition  //////////////////////////////////////////////////////////
+//
+template<class K>
+class IndexedMinHeap
+{
+
+// Public members.
+public:
+    IndexedMinHeap(
+        size_t capacity = 0,
+        std::shared_ptr< Arena > arena_ptr = std::shared_ptr< Arena >(nullptr)
+    ); /**< Parameterized constructor */
+    IndexedMinHeap(const IndexedMinHeap< K >&); /**< Copy constructor */
+    ~IndexedMinHeap(); /**< Destructor */
+
+    bool empty() const; /**< Returns boolean indicating if heap is empty */
+    size_t size() const; /**< Returns number of indices in the heap */
+    bool contains(size_t) const; /**< Returns boolean indicating if index is in the heap */
+    K key(size_t) const; /**< Returns the key of an index in the heap */
+    size_t top() const; /**< Returns the index with the smallest key (ties go to the smallest index) */
+    K top_key() const; /**< Returns the smallest key in the heap */
+    size_t second() const; /**< Returns the index that would be on top after a pop (requires size() > 1) */
+    void update(size_t, K); /**< Inserts index with key, or moves it if already present */
+    bool erase(size_t); /**< Removes index from the heap and returns boolean indicating success */
+    bool pop(); /**< Removes the top index and returns boolean indicating success */
+
+// Private members.
+private:
+    static const size_t npos_ = static_cast< size_t >(-1); /**< Position of indices not in the heap */
+
+    std::vector< size_t, ArenaAllocator< size_t > > heap_; /**< Indices in heap order */
+    std::vector< size_t, ArenaAllocator< size_t > > positions_; /**< Position in heap of each index, or npos_ */
+    std::vector< K, ArenaAllocator< K > > keys_; /**< Key of each index */
+
+    bool precedes(size_t, size_t) const; /**< Returns boolean indicating if heap slot a orders before heap slot b */
+    void swap_slots(size_t, size_t); /**< Swaps two heap slots and fixes their positions */
+    void sift_up(size_t); /**< Restores heap order upward from slot */
+    void sift_down(size_t); /**< Restores heap order downward from slot */
+
+};
+//
+//  Implementation Files  //////////////////////////////////////////////////////
+//
+#include "IndexedMinHeap.cpp"
+//
+//  Terminating Precompiler Directives  ////////////////////////////////////////
+//
+#endif // INDEXED_MIN_HEAP_H_
+//
@@ -29,7 +29,7 @@
  *            Name of output file
  *
  */
-Logger::Logger(std::string name) : file_name_(name), file_stream_(std::ofstream(name)) {}
+Logger::Logger(std::string name) : file_name_(name), file_stream_(std::ofstream(name)), customers_logged_(0) {}
 //
 //  Class Member Implementation  ///////////////////////////////////////////////
 //
@@ -39,7 +39,7 @@ Logger::Logger(std::string name) : file_name_(name), file_stream_(std::ofstream(
  *
  */
 Logger::Logger(const Logger& origin)
-    : file_name_(origin.file_name_), file_stream_(std::ofstream(origin.file_name_)) {}
+    : file_name_(origin.file_name_), file_stream_(std::ofstream(origin.file_name_)), customers_logged_(0) {}
 //
 //  Class Member Implementation  ///////////////////////////////////////////////
 //
@@ -68,36 +68,101 @@ Logger::~Logger()
  *
  */
 void Logger::log_customer_list(std::string header, std::shared_ptr< std::list< Customer > > data_set_ptr)
+{
+    // Header.
+    begin_customer_list(header);
+
+    // Output data set.
+    for (auto& customer : *data_set_ptr)
+    {
+        // Log.
+        log_customer(customer);
+    }
+
+    // End.
+    end_customer_list();
+}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Writes the header of a data set whose customers are logged in
+ *          runs as they are produced (see log_customers), so the data set
+ *          never has to be held at once
+ *
+ * @param[in] header
+ *            Header to be displayed in record
+ *
+ */
+void Logger::begin_customer_list(std::string header)
 {
     // Header.
     file_stream_ << "\n\n"
                  << "================================================================================\n"
                  << header << '\n'
                  << "================================================================================\n";
-    
-    // Cursor.
-    auto cursor_it = data_set_ptr->begin();
 
-    // End.
-    auto end_it = data_set_ptr->end();
-    
-    // Output data set.
-    for (auto i = 0; cursor_it != end_it; i++)
+    // Restart numbering.
+    customers_logged_ = 0;
+}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Logs a run of customers to the data set being logged, numbering
+ *          them after the customers already logged
+ *
+ * @param[in] customers
+ *            Pointer to the first customer of the run
+ *
+ * @param[in] count
+ *            Number of customers in the run
+ *
+ */
+void Logger::log_customers(const Customer* customers, size_t count)
+{
+    // Output run.
+    for (auto i = (size_t) 0; i < count; i++)
     {
         // Log.
-        file_stream_ << i + 1 << ". Arrival time: " << cursor_it->arrival_time()
-                              << ", Transaction time: " << cursor_it->transaction_length() << '\n';
-
-        // Advance.
-        ++cursor_it;
+        log_customer(customers[i]);
     }
-
+}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Finishes logging the data set
+ *
+ */
+void Logger::end_customer_list()
+{
     // End.
     file_stream_ << "================================================================================\n";
 }
 //
 //  Class Member Implementation  ///////////////////////////////////////////////
 //
+/**
+ *
+ * @details Logs a customer, numbered within the data set being logged
+ *
+ * @param[in] customer
+ *            Customer to log
+ *
+ */
+void Logger::log_customer(const Customer& customer)
+{
+    // Log.
+    file_stream_ << ++customers_logged_ << ". Arrival time: " << customer.arrival_time()
+                 << ", Transaction time: " << customer.transaction_length() << '\n';
+}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
 /**
  *
  * @details Logs simulation results to file with specified header
@@ -105,12 +170,16 @@ void Logger::log_customer_list(std::string header, std::shared_ptr< std::list< C
  * @param[in] header
  *            Header to be displayed in record
  *
- * @param[in] sim_ptr
- *            Smart pointer to simulation
+ * @param[in] report
+ *            Report returned by the simulation's run
  *
  */
-void Logger::log_sim_results(std::string header, std::shared_ptr< ServiceQueueSimulation > sim_ptr)
+void Logger::log_sim_results(std::string header, const SimulationReport& report)
 {
+    // Percentiles.
+    auto& waits = report.wait_percentiles();
+    auto& sojourns = report.sojourn_percentiles();
+
     // Output.
     file_stream_ << "\n\n"
 
@@ -120,44 +189,135 @@ void Logger::log_sim_results(std::string header, std::shared_ptr< ServiceQueueSi
                  << "================================================================================\n"
     
                  // CPU time.
-                 << "CPU Time: " << sim_ptr->time_elapsed() << " milliseconds\n"
+                 << "CPU Time: " << report.cpu_time() << " milliseconds\n"
 
                  // Simulation time.
-                 << "Simulation Time: " << sim_ptr->sim_time() << " simulation time units\n"
+                 << "Simulation Time: " << report.sim_time() << " simulation time units\n"
 
                  // Average wait time.
-                 << "Average Wait Time: " << sim_ptr->average_customer_wait_time() << " simulation time units\n"
+                 << "Average Wait Time: " << (float) report.waits().mean() << " simulation time units\n"
 
                  // Maximum wait time.
-                 << "Maximum Wait Time: " << sim_ptr->max_customer_wait_time() << " simulation time units\n"
+                 << "Maximum Wait Time: " << (unsigned int) report.waits().max() << " simulation time units\n"
+
+                 // Wait time deviation.
+                 << "Wait Time Standard Deviation: " << (float) report.waits().standard_deviation() << " simulation time units\n"
+
+                 // Wait time percentiles.
+                 << "Wait Time p50/p90/p99/p99.9: "
+                 << waits.p50 << " / " << waits.p90 << " / " << waits.p99 << " / " << waits.p999
+                 << " simulation time units\n"
+
+                 // Average sojourn time.
+                 << "Average Time in System: " << (float) report.sojourns().mean() << " simulation time units\n"
+
+                 // Maximum sojourn time.
+                 << "Maximum Time in System: " << (unsigned int) report.sojourns().max() << " simulation time units\n"
+
+                 // Sojourn time percentiles.
+                 << "Time in System p50/p90/p99/p99.9: "
+                 << sojourns.p50 << " / " << sojourns.p90 << " / " << sojourns.p99 << " / " << sojourns.p999
+                 << " simulation time units\n"
 
                  // Average line length.
-                 << "Average Line Length: " << sim_ptr->average_line_length() << " customers\n"
+                 << "Average Line Length: " << report.average_line_length() << " customers\n"
 
                  // Maximum line length.
-                 << "Maximum Line Length: " << sim_ptr->max_line_length() << " customers\n";
+                 << "Maximum Line Length: " << report.max_line_length() << " customers\n"
 
-    // Idle times.
-    auto idle_times_ptr = sim_ptr->total_servicer_idle_times();
+                 // Average number waiting.
+                 << "Average Customers Waiting: " << report.average_customers_waiting() << " customers\n"
 
-    // Cursor and end.
-    auto cursor_it = idle_times_ptr->begin();
-    auto end_it = idle_times_ptr->end();
+                 // Arena usage.
+                 << "Arena Allocations: " << report.arena_allocations()
+                 << " (" << report.arena_bytes() << " bytes)\n";
 
-    // Teller idle time.
-    for (auto i = 0; cursor_it != end_it; i++)
+    // Line lengths.
+    for (auto i = (size_t) 0; i < report.line_lengths().size(); i++)
     {
         // Log.
-        file_stream_ << "Servicer #" << i + 1 << " Idle Time: " << *cursor_it << '\n';
+        file_stream_ << "Line #" << i + 1 << " Average Length: " << report.line_lengths()[i] << '\n';
+    }
 
-        // Advance.
-        ++cursor_it;
+    // Teller idle time.
+    for (auto i = (size_t) 0; i < report.servicer_idle_times().size(); i++)
+    {
+        // Log.
+        file_stream_ << "Servicer #" << i + 1 << " Idle Time: " << report.servicer_idle_times()[i] << '\n';
     }
 
     // End.
     file_stream_ << "================================================================================\n";
 }
 //
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Logs merged results of independent replications to file with
+ *          specified header, each output as its mean across replications and
+ *          the half-width of its 95% confidence interval
+ *
+ * @param[in] header
+ *            Header to be displayed in record
+ *
+ * @param[in] summary
+ *            Summary returned by the replication runner
+ *
+ */
+void Logger::log_replication_summary(std::string header, const ReplicationSummary& summary)
+{
+    // Header.
+    file_stream_ << "\n\n"
+                 << "================================================================================\n"
+                 << header << '\n'
+                 << "================================================================================\n"
+                 << "Replications: " << summary.replication_count() << " (mean +/- 95% confidence half-width)\n";
+
+    // Outputs.
+    log_interval("Simulation Time", summary.sim_time(), "simulation time units");
+    log_interval("Average Wait Time", summary.average_wait(), "simulation time units");
+    log_interval("Maximum Wait Time", summary.max_wait(), "simulation time units");
+    log_interval("Wait Time p90", summary.wait_p90(), "simulation time units");
+    log_interval("Wait Time p99", summary.wait_p99(), "simulation time units");
+    log_interval("Average Time in System", summary.average_sojourn(), "simulation time units");
+    log_interval("Time in System p99", summary.sojourn_p99(), "simulation time units");
+    log_interval("Average Line Length", summary.average_line_length(), "customers");
+    log_interval("Maximum Line Length", summary.max_line_length(), "customers");
+    log_interval("Average Customers Waiting", summary.average_customers_waiting(), "customers");
+
+    // Pooled.
+    file_stream_ << "Customers (all replications): " << summary.pooled_waits().count() << '\n'
+                 << "Pooled Wait Time Standard Deviation: " << (float) summary.pooled_waits().standard_deviation()
+                 << " simulation time units\n";
+
+    // End.
+    file_stream_ << "================================================================================\n";
+}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Logs one line: label, mean, confidence half-width, and unit
+ *
+ * @param[in] label
+ *            Name of the output
+ *
+ * @param[in] statistics
+ *            Observations of the output, one per replication
+ *
+ * @param[in] unit
+ *            Unit of the output
+ *
+ */
+void Logger::log_interval(std::string label, const RunningStatistics& statistics, std::string unit)
+{
+    // Log.
+    file_stream_ << label << ": " << (float) statistics.mean()
+                 << " +/- " << (float) statistics.confidence_half_width() << ' ' << unit << '\n';
+}
+//
 //  Terminating Precompiler Directives  ////////////////////////////////////////
 //
 #endif // LOGGER_CPP_
@@ -24,7 +24,9 @@
 #include <utility>
 #include <iterator>
 #include "../ServiceQueueSimulation/Customer.h"
-#include "../ServiceQueueSimulation/ServiceQueueSimulation.h"
+#include "../ServiceQueueSimulation/SimulationReport.h"
+#include "../Statistics/RunningStatistics.h"
+#include "../Replication/ReplicationSummary.h"
 #include <iostream> // TODO: REMOVE
 //
 //  Class Definition  //////////////////////////////////////////////////////////
@@ -42,15 +44,20 @@ public:
         std::string,
         std::shared_ptr< std::list< Customer > >
     ); /**< Logs list of pairs to file */
-    void log_sim_results(
-        std::string,
-        std::shared_ptr< ServiceQueueSimulation >
-    ); /**< Logs simulation results to file */
+    void begin_customer_list(std::string); /**< Starts logging a data set whose customers arrive in runs */
+    void log_customers(const Customer*, size_t); /**< Logs a run of customers to the data set being logged */
+    void end_customer_list(); /**< Finishes logging the data set */
+    void log_sim_results(std::string, const SimulationReport&); /**< Logs simulation results to file */
+    void log_replication_summary(std::string, const ReplicationSummary&); /**< Logs merged results of replications to file */
 
 // Private members.
 private:
+    void log_interval(std::string, const RunningStatistics&, std::string); /**< Logs a labeled mean and its confidence interval */
+    void log_customer(const Customer&); /**< Logs a numbered customer to the data set being logged */
+
     std::string file_name_; /**< Output file name */
     std::ofstream file_stream_; /**< Output file stream */
+    size_t customers_logged_; /**< Customers logged to the current data set */
 
 };
 //
@@ -24,6 +24,12 @@
 #define NUM_TELLERS_SIM_2 (unsigned int) 3
 #define NUM_TELLERS_SIM_3 (unsigned int) 3
 #define NUM_TELLERS_SIM_4 (unsigned int) 8
+#define INITIAL_LANE_CAPACITY (size_t) 64
+#define ARRIVAL_FEED_CAPACITY (size_t) 4096
+#define NUM_TELLERS_REPLICATED (unsigned int) 3
+#define NUM_REPLICATIONS (size_t) 10
+#define REPLICATION_SEED (std::uint64_t) 20160405
+#define DATA_SEED (std::uint64_t) 20160330
 //
 //  Header Files  //////////////////////////////////////////////////////////////
 //
@@ -31,14 +37,21 @@
 #include <memory>
 #include <list>
 #include <chrono>
+#include <thread>
+#include <cstdint>
 #include "utils/data_generator.h"
-#include "utils/sorter.h"
 #include "Queue/Queue.h"
-#include "Queue/QueueList.h"
+#include "Queue/QueueChunkList.h"
+#include "Queue/QueueIntrusive.h"
+#include "Queue/QueueSpsc.h"
 #include "Queue/QueueArray.h"
 #include "Logger/Logger.h"
 #include "ServiceQueueSimulation/Customer.h"
 #include "ServiceQueueSimulation/ServiceQueueSimulation.h"
+#include "ArrivalSource/RandomArrivalSource.h"
+#include "Random/SplitMix64.h"
+#include "ThreadPool/ThreadPool.h"
+#include "Replication/ReplicationRunner.h"
 //
 //  Main Function Implementation  //////////////////////////////////////////////
 //
@@ -54,70 +67,43 @@ int main()
   auto data_set2_ptr = std::shared_ptr< std::list< Customer > >(
     new std::list< Customer >()
   );
-  auto data_set3_ptr = std::shared_ptr< std::list< Customer > >(
-    new std::list< Customer >()
+
+  // Arrival feed for data set #3 (streamed while simulation #3 runs).
+  auto arrival_feed_ptr = std::shared_ptr< QueueSpsc< Customer > >(
+    new QueueSpsc< Customer >(ARRIVAL_FEED_CAPACITY)
   );
 
   // Loggers.
   auto data_logger = Logger("data.txt");
   auto stats_logger = Logger("results.txt");
 
-  // Generate random data for data set #1.
-  data_generator::generate_random_data(
-    NUM_EVENTS,
-    MIN_START_TIME,
-    MAX_START_TIME,
-    MIN_TRANSACTION_TIME,
-    MAX_TRANSACTION_TIME,
-    data_set1_ptr
-  );
-
-  // Generate random data for data set #2.
-  data_generator::generate_random_data(
-    NUM_EVENTS,
-    MIN_START_TIME,
-    MAX_START_TIME,
-    MIN_TRANSACTION_TIME,
-    MAX_TRANSACTION_TIME,
-    data_set2_ptr
-  );
+  // Generate data sets #1 and #2 already sorted by arrival time, concurrently, each from its own seed.
+  auto generator1_thread = std::thread([data_set1_ptr] () {
+    data_generator::generate_sorted_random_data(
+      NUM_EVENTS,
+      MIN_START_TIME,
+      MAX_START_TIME,
+      MIN_TRANSACTION_TIME,
+      MAX_TRANSACTION_TIME,
+      SplitMix64::at(DATA_SEED, 0),
+      data_set1_ptr
+    );
+  });
+  auto generator2_thread = std::thread([data_set2_ptr] () {
+    data_generator::generate_sorted_random_data(
+      NUM_EVENTS,
+      MIN_START_TIME,
+      MAX_START_TIME,
+      MIN_TRANSACTION_TIME,
+      MAX_TRANSACTION_TIME,
+      SplitMix64::at(DATA_SEED, 1),
+      data_set2_ptr
+    );
+  });
 
-  // Generate random data for data set #3.
-  data_generator::generate_random_data(
-    NUM_EVENTS,
-    MIN_START_TIME,
-    MAX_START_TIME,
-    MIN_TRANSACTION_TIME,
-    MAX_TRANSACTION_TIME,
-    data_set3_ptr
-  );
-
-  // Checkpoint.
-  std::cout << "\n\nSorting data set by start time...\n" << std::endl;
-
-  // Sort data set #1.
-  sorter::counting_sort_by_arrival_time(
-    data_set1_ptr->begin(),
-    data_set1_ptr->end(),
-    MIN_START_TIME,
-    MAX_START_TIME
-  );
-
-  // Sort data set #2.
-  sorter::counting_sort_by_arrival_time(
-    data_set2_ptr->begin(),
-    data_set2_ptr->end(),
-    MIN_START_TIME,
-    MAX_START_TIME
-  );
-
-  // Sort data set #3.
-  sorter::counting_sort_by_arrival_time(
-    data_set3_ptr->begin(),
-    data_set3_ptr->end(),
-    MIN_START_TIME,
-    MAX_START_TIME
-  );
+  // Wait for generators.
+  generator1_thread.join();
+  generator2_thread.join();
 
   // Checkpoint.
   std::cout << "\n\nLogging data sets...\n" << std::endl;
@@ -125,19 +111,18 @@ int main()
   // Log data sets.
   data_logger.log_customer_list("Data set #1", data_set1_ptr);
   data_logger.log_customer_list("Data set #2", data_set2_ptr);
-  data_logger.log_customer_list("Data set #3", data_set3_ptr);
 
 
   // Checkpoint.
   std::cout << "\n\nCreating simulations...\n" << std::endl;
 
 
-  // Simulation #1.
-  auto sim1 = ServiceQueueSimulation(
+  // Simulation #1 (single lane type, so queue calls are statically dispatched).
+  auto sim1 = BasicServiceQueueSimulation< QueueArray< CustomerId > >(
     NUM_TELLERS_SIM_1,
     data_set1_ptr,
-    std::shared_ptr< QueueArray< std::shared_ptr< Customer > > >(
-      new QueueArray< std::shared_ptr< Customer > >(NUM_EVENTS)
+    std::shared_ptr< QueueArray< CustomerId > >(
+      new QueueArray< CustomerId >(INITIAL_LANE_CAPACITY, QueueArrayGrowth::grow)
     )
   );
   
@@ -145,29 +130,29 @@ int main()
   auto sim2 = ServiceQueueSimulation(
     NUM_TELLERS_SIM_2,
     data_set2_ptr,
-    std::shared_ptr< QueueArray< std::shared_ptr< Customer > > >(
-      new QueueArray< std::shared_ptr< Customer > >(NUM_EVENTS)
+    std::shared_ptr< QueueArray< CustomerId > >(
+      new QueueArray< CustomerId >(INITIAL_LANE_CAPACITY, QueueArrayGrowth::grow)
     ),
-    std::shared_ptr< QueueList< std::shared_ptr< Customer > > >(
-      new QueueList< std::shared_ptr< Customer > >()
+    std::shared_ptr< QueueChunkList< CustomerId > >(
+      new QueueChunkList< CustomerId >()
     ),
-    std::shared_ptr< QueueArray< std::shared_ptr< Customer > > >(
-      new QueueArray< std::shared_ptr< Customer > >(NUM_EVENTS)
+    std::shared_ptr< QueueArray< CustomerId > >(
+      new QueueArray< CustomerId >(INITIAL_LANE_CAPACITY, QueueArrayGrowth::grow)
     )
   );
 
-  // Simulation #3.
+  // Simulation #3 (intrusive lanes are linked through the simulation's customers).
   auto sim3 = ServiceQueueSimulation(
     NUM_TELLERS_SIM_3,
-    data_set3_ptr,
-    std::shared_ptr< QueueList< std::shared_ptr< Customer > > >(
-      new QueueList< std::shared_ptr< Customer > >()
+    arrival_feed_ptr,
+    std::shared_ptr< QueueIntrusive< CustomerId > >(
+      new QueueIntrusive< CustomerId >()
     ),
-    std::shared_ptr< QueueArray< std::shared_ptr< Customer > > >(
-      new QueueArray< std::shared_ptr< Customer > >(NUM_EVENTS)
+    std::shared_ptr< QueueArray< CustomerId > >(
+      new QueueArray< CustomerId >(INITIAL_LANE_CAPACITY, QueueArrayGrowth::grow)
     ),
-    std::shared_ptr< QueueList< std::shared_ptr< Customer > > >(
-      new QueueList< std::shared_ptr< Customer > >()
+    std::shared_ptr< QueueIntrusive< CustomerId > >(
+      new QueueIntrusive< CustomerId >()
     )
   );
 
@@ -175,11 +160,11 @@ int main()
   auto sim4 = ServiceQueueSimulation(
     NUM_TELLERS_SIM_4,
     data_set1_ptr,
-    std::shared_ptr< QueueArray< std::shared_ptr< Customer > > >(
-      new QueueArray< std::shared_ptr< Customer > >(NUM_EVENTS)
+    std::shared_ptr< QueueArray< CustomerId > >(
+      new QueueArray< CustomerId >(INITIAL_LANE_CAPACITY, QueueArrayGrowth::grow)
     ),
-    std::shared_ptr< QueueList< std::shared_ptr< Customer > > >(
-      new QueueList< std::shared_ptr< Customer > >()
+    std::shared_ptr< QueueChunkList< CustomerId > >(
+      new QueueChunkList< CustomerId >()
     )
   );
 
@@ -187,49 +172,86 @@ int main()
   std::cout << "\n\nRunning simulations...\n" << std::endl;
 
   // Simulation #1.
-  sim1.run();
+  auto report1 = sim1.run();
 
   // Checkpoint.
   std::cout << "\n\nFinished simulation #1...\n" << std::endl;
 
   // Simulation #2.
-  sim2.run();
+  auto report2 = sim2.run();
 
   // Checkpoint.
   std::cout << "\n\nFinished simulation #2...\n" << std::endl;
 
+  // Start logging data set #3 (the generator logs each run as it streams it).
+  data_logger.begin_customer_list("Data set #3");
+
+  // Generate data set #3 on another thread, already sorted, while simulation #3 consumes it.
+  auto generator_thread = std::thread(
+    data_generator::stream_sorted_random_data,
+    NUM_EVENTS,
+    MIN_START_TIME,
+    MAX_START_TIME,
+    MIN_TRANSACTION_TIME,
+    MAX_TRANSACTION_TIME,
+    SplitMix64::at(DATA_SEED, 2),
+    arrival_feed_ptr,
+    [&data_logger] (const Customer* run, size_t count) {
+      data_logger.log_customers(run, count);
+    }
+  );
+
   // Simulation #3.
-  sim3.run();
+  auto report3 = sim3.run();
+
+  // Wait for generator.
+  generator_thread.join();
+  data_logger.end_customer_list();
 
   // Checkpoint.
   std::cout << "\n\nFinished simulation #3...\n" << std::endl;
 
   // Simulation #4.
-  sim4.run();
+  auto report4 = sim4.run();
 
   // Checkpoint.
   std::cout << "\n\nFinished simulation #4...\n" << std::endl;
 
+  // Checkpoint.
+  std::cout << "\n\nRunning replications...\n" << std::endl;
+
+  // Replications of three tellers over three array-based lanes, each on its own random stream.
+  auto runner = ReplicationRunner(std::make_shared< ThreadPool >(), REPLICATION_SEED);
+  auto replicated = runner.run(
+    [] (std::uint64_t seed) {
+      auto sim = BasicServiceQueueSimulation< QueueArray< CustomerId > >(
+        NUM_TELLERS_REPLICATED,
+        std::shared_ptr< ArrivalSource >(new RandomArrivalSource(
+          NUM_EVENTS,
+          MIN_START_TIME,
+          MAX_START_TIME,
+          MIN_TRANSACTION_TIME,
+          MAX_TRANSACTION_TIME,
+          seed
+        )),
+        std::make_shared< QueueArray< CustomerId > >(INITIAL_LANE_CAPACITY, QueueArrayGrowth::grow),
+        std::make_shared< QueueArray< CustomerId > >(INITIAL_LANE_CAPACITY, QueueArrayGrowth::grow),
+        std::make_shared< QueueArray< CustomerId > >(INITIAL_LANE_CAPACITY, QueueArrayGrowth::grow)
+      );
+      return sim.run();
+    },
+    NUM_REPLICATIONS
+  );
+
   // Checkpoint.
   std::cout << "\n\nLogging results...\n" << std::endl;
 
   // Log statistics.
-  stats_logger.log_sim_results(
-    "Simulation #1 (link-based queue)",
-    std::shared_ptr< ServiceQueueSimulation >(new ServiceQueueSimulation(sim1))
-  );
-  stats_logger.log_sim_results(
-    "Simulation #2 (array-based and link-based queues)",
-    std::shared_ptr< ServiceQueueSimulation >(new ServiceQueueSimulation(sim2))
-  );
-  stats_logger.log_sim_results(
-    "Simulation #3 (array-based queue)",
-    std::shared_ptr< ServiceQueueSimulation >( new ServiceQueueSimulation(sim3))
-  );
-  stats_logger.log_sim_results(
-    "Simulation #4 (array-based and link-based queues)",
-    std::shared_ptr< ServiceQueueSimulation >(new ServiceQueueSimulation(sim4))
-  );
+  stats_logger.log_sim_results("Simulation #1 (link-based queue)", report1);
+  stats_logger.log_sim_results("Simulation #2 (array-based and link-based queues)", report2);
+  stats_logger.log_sim_results("Simulation #3 (array-based queue)", report3);
+  stats_logger.log_sim_results("Simulation #4 (array-based and link-based queues)", report4);
+  stats_logger.log_replication_summary("Replicated simulation (3 tellers, array-based queues)", replicated);
 
   // Return.
   return 0;
@@ -0,0 +1,46 @@
+/**
+ *
+ * @file Queue.cpp
+ *
+ * @brief Abstract base class for queues
+ *
+ * @author Josh Wiley
+ *
+ * @details Implements the non-virtual members of the Queue abstract base class
+ *
+ */
+//
+//  Preprocessor Directives  ///////////////////////////////////////////////////
+//
+#ifndef QUEUE_CPP_
+#define QUEUE_CPP_
+//
+//  Header Files  //////////////////////////////////////////////////////////////
+//
+#include "Queue.h"
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Constructs an item from the arguments and moves it to the end of
+ *          the queue (QueueList hides this with an in-place version)
+ *
+ * @param[in] args
+ *            Arguments forwarded to the item's constructor
+ *
+ * @return Boolean value indicating the success of the operation
+ *
+ */
+template<typename T>
+template<typename ... A>
+bool Queue<T>::emplace(A&& ... args)
+{
+  // Construct and move in.
+  return enqueue(T(std::forward< A >(args)...));
+}
+//
+//  Terminating Precompiler Directives  ////////////////////////////////////////
+//
+#endif // QUEUE_CPP_
+//
@@ -18,6 +18,7 @@
 //  Header Files  //////////////////////////////////////////////////////////////
 //
 #include <cstddef>
+#include <utility>
 //
 //  Class Definition  //////////////////////////////////////////////////////////
 //
@@ -28,12 +29,25 @@ class Queue
 // Public members.
 public:
     virtual bool empty() const = 0; /**< Returns boolean indicating if queue is empty */
-    virtual bool enqueue(T) = 0; /**< Places an item at the end of the queue and returns boolean indicating success */
+    virtual bool enqueue(const T&) = 0; /**< Copies an item to the end of the queue and returns boolean indicating success */
+    virtual bool enqueue(T&&) = 0; /**< Moves an item to the end of the queue and returns boolean indicating success */
     virtual bool dequeue() = 0; /**< Removes and returns the item in the front of the queue */
     virtual T peek() const = 0; /**< Returns the item in the front of the queue without modifying the data */
+    virtual const T& front() const = 0; /**< Returns a reference to the item in the front of the queue */
+    virtual bool try_pop(T&) = 0; /**< Moves the front item into the out parameter and removes it, returns boolean indicating success */
     virtual size_t size() const = 0; /**< Returns size of queue */
+    virtual size_t enqueue_range(const T*, const T*) = 0; /**< Copies a contiguous range to the end of the queue and returns number of items placed */
+    virtual size_t dequeue_batch(T*, size_t) = 0; /**< Moves up to n front items into an array, removes them, and returns number moved */
+
+
+    template<class ... A>
+    bool emplace(A&& ...); /**< Constructs an item at the end of the queue and returns boolean indicating success */
 };
 //
+//  Implementation Files  //////////////////////////////////////////////////////
+//
+#include "Queue.cpp"
+//
 //  Terminating Precompiler Directives  ////////////////////////////////////////
 //
 #endif // QUEUE_H_
@@ -23,7 +23,9 @@
 //
 /**
  *
- * @details Allocates heap memory and copies data if pointer provided is valid
+ * @details Allocates heap memory and copies data if pointer provided is
+ *          valid; the queue holds at most max_size items (slots are rounded
+ *          up to a power of two so indexing is a mask)
  *
  * @param[in] max_size
  *            The maximum size (determines heap memory allocated)
@@ -34,40 +36,64 @@
  */
 template<typename T>
 QueueArray<T>::QueueArray(size_t max_size, std::shared_ptr< std::list<T> > data_ptr)
-    : begin_(0), max_(max_size)
+    : begin_(0), end_(0), max_(max_size),
+      capacity_(round_up_to_power_of_two(max_size)), mask_(capacity_ - 1),
+      min_capacity_(capacity_), growth_(QueueArrayGrowth::fixed)
 {
     // Allocate.
-    data_set_ptr_.reset(new T[max_], [] (auto ptr) { delete[] ptr; });
+    data_set_ptr_.reset(new T[capacity_], [] (auto ptr) { delete[] ptr; });
     
     // Is pointer valid?
     if (data_ptr == nullptr)
     {
-        // Set end value.
-        end_ = 0;
-
         // Return.
         return;
     }
 
-    // Size.
-    end_ = data_ptr->size();
-
     // Cursor.
     auto cursor = data_ptr->begin();
 
-    // Copy data set.
-    for (auto i = 0; cursor != data_ptr->end(); i++)
+    // Copy data set (up to the maximum size).
+    while (cursor != data_ptr->end() && end_ < max_)
     {
         // Copy.
-        data_set_ptr_.get()[i] = *cursor;
+        data_set_ptr_.get()[end_] = *cursor;
 
         // Advance.
         ++cursor;
+        end_++;
     }
 }
 //
 //  Class Member Implementation  ///////////////////////////////////////////////
 //
+/**
+ *
+ * @details Allocates a power-of-two number of slots; with a growing policy
+ *          the queue is unbounded and only uses memory proportional to the
+ *          most items it has held at once
+ *
+ * @param[in] initial_capacity
+ *            Number of slots to start with (the maximum size for a fixed
+ *            policy, the minimum capacity for a shrinking policy)
+ *
+ * @param[in] growth
+ *            Capacity policy
+ *
+ */
+template<typename T>
+QueueArray<T>::QueueArray(size_t initial_capacity, QueueArrayGrowth growth)
+    : begin_(0), end_(0),
+      max_(growth == QueueArrayGrowth::fixed ? initial_capacity : static_cast< size_t >(-1)),
+      capacity_(round_up_to_power_of_two(initial_capacity)), mask_(capacity_ - 1),
+      min_capacity_(capacity_), growth_(growth)
+{
+    // Allocate.
+    data_set_ptr_.reset(new T[capacity_], [] (auto ptr) { delete[] ptr; });
+}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
 /**
  *
  * @details Copy-initializes queue from another queue
@@ -75,23 +101,18 @@ QueueArray<T>::QueueArray(size_t max_size, std::shared_ptr< std::list<T> > data_
  */
 template<typename T>
 QueueArray<T>::QueueArray(const QueueArray<T>& origin)
-    : begin_(origin.begin_ % origin.max_), end_((origin.end_ % origin.max_) + 1), max_(origin.max_)
+    : begin_(0), end_(origin.size()), max_(origin.max_),
+      capacity_(origin.capacity_), mask_(origin.mask_),
+      min_capacity_(origin.min_capacity_), growth_(origin.growth_)
 {
     // Allocate.
-    data_set_ptr_.reset(new T[max_], [] (auto ptr) { delete[] ptr; });
+    data_set_ptr_.reset(new T[capacity_], [] (auto ptr) { delete[] ptr; });
 
-    // Is pointer valid?
-    if (origin.data_set_ptr_ != nullptr)
+    // Copy data set.
+    for (auto i = origin.begin_; i < origin.end_; i++)
     {
-        // Size.
-        end_ = origin.size();
-
-        // Copy data set.
-        for (auto i = origin.begin_; i < origin.end_; i++)
-        {
-            // Copy item.
-            data_set_ptr_.get()[i % max_] = origin.data_set_ptr_.get()[i % max_];
-        }
+        // Copy item.
+        data_set_ptr_.get()[i - origin.begin_] = origin.data_set_ptr_.get()[i & mask_];
     }
 }
 //
@@ -125,7 +146,40 @@ bool QueueArray<T>::empty() const
 //
 /**
  *
- * @details Attempts to place an item at the end of the queue and returns a
+ * @details Attempts to copy an item to the end of the queue and returns a
+ *          boolean value indicating the success of the operation
+ *
+ * @param[in] input
+ *            Item to place at the end of the queue
+ *
+ * @return Boolean value indicating the success of the operation
+ *
+ */
+template<typename T>
+bool QueueArray<T>::enqueue(const T& input)
+{
+  // Available space?
+  if (!make_room(1))
+  {
+    // Failure.
+    return false;
+  }
+
+  // Place value.
+  data_set_ptr_.get()[end_ & mask_] = input;
+
+  // Increment end.
+  end_++;
+
+  // Success.
+  return true;
+}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Attempts to move an item to the end of the queue and returns a
  *          boolean value indicating the success of the operation
  *
  * @param[in] input
@@ -135,17 +189,17 @@ bool QueueArray<T>::empty() const
  *
  */
 template<typename T>
-bool QueueArray<T>::enqueue(T input)
+bool QueueArray<T>::enqueue(T&& input)
 {
   // Available space?
-  if (size() == max_)
+  if (!make_room(1))
   {
     // Failure.
     return false;
   }
 
   // Place value.
-  data_set_ptr_.get()[end_ % max_] = input;
+  data_set_ptr_.get()[end_ & mask_] = std::move(input);
 
   // Increment end.
   end_++;
@@ -176,6 +230,9 @@ bool QueueArray<T>::dequeue()
   // Increment front.
   begin_++;
 
+  // Release memory if sparse.
+  shrink_if_sparse();
+
   // Return success.
   return true;
 }
@@ -184,16 +241,69 @@ bool QueueArray<T>::dequeue()
 //
 /**
  *
- * @details Removes the item at the front of the queue
+ * @details Returns a copy of the item at the front of the queue
  *
- * @return Boolean value indicating the success of the operation.
+ * @return Item at the front of the queue
  *
  */
 template<typename T>
 T QueueArray<T>::peek() const
 {
   // Return front item.
-  return data_set_ptr_.get()[begin_ % max_];
+  return data_set_ptr_.get()[begin_ & mask_];
+}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Returns a reference to the item at the front of the queue (valid
+ *          until the queue is next modified)
+ *
+ * @return Reference to the item at the front of the queue
+ *
+ */
+template<typename T>
+const T& QueueArray<T>::front() const
+{
+  // Return front item.
+  return data_set_ptr_.get()[begin_ & mask_];
+}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Moves the item at the front of the queue into the out parameter
+ *          and removes it
+ *
+ * @param[out] output
+ *             Assigned the item at the front of the queue
+ *
+ * @return Boolean value indicating the success of the operation
+ *
+ */
+template<typename T>
+bool QueueArray<T>::try_pop(T& output)
+{
+  // Empty?
+  if (empty())
+  {
+    // Return failure.
+    return false;
+  }
+
+  // Move out.
+  output = std::move(data_set_ptr_.get()[begin_ & mask_]);
+
+  // Increment front.
+  begin_++;
+
+  // Release memory if sparse.
+  shrink_if_sparse();
+
+  // Return success.
+  return true;
 }
 //
 //  Class Member Implementation  ///////////////////////////////////////////////
@@ -214,6 +324,84 @@ size_t QueueArray<T>::size() const
 //
 //  Class Member Implementation  ///////////////////////////////////////////////
 //
+/**
+ *
+ * @details Copies as much of the range as fits to the end of the queue, in
+ *          at most two contiguous copies (before and after the wrap point)
+ *
+ * @param[in] first
+ *            Pointer to the first item to place
+ *
+ * @param[in] last
+ *            Pointer past the last item to place
+ *
+ * @return Number of items placed
+ *
+ */
+template<typename T>
+size_t QueueArray<T>::enqueue_range(const T* first, const T* last)
+{
+  // Number that fit (growing if allowed).
+  auto count = std::min((size_t) (last - first), max_ - size());
+  make_room(count);
+
+  // Slots until the wrap point.
+  auto slot = end_ & mask_;
+  auto head = std::min(count, capacity_ - slot);
+
+  // Copy up to the wrap point, then from the start of the buffer.
+  std::copy(first, first + head, data_set_ptr_.get() + slot);
+  std::copy(first + head, first + count, data_set_ptr_.get());
+
+  // Advance end.
+  end_ += count;
+
+  // Return.
+  return count;
+}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Moves up to max_count items from the front of the queue, in at
+ *          most two contiguous moves (before and after the wrap point)
+ *
+ * @param[out] output
+ *             Array receiving the items, in queue order
+ *
+ * @param[in] max_count
+ *            Maximum number of items to move
+ *
+ * @return Number of items moved
+ *
+ */
+template<typename T>
+size_t QueueArray<T>::dequeue_batch(T* output, size_t max_count)
+{
+  // Number available.
+  auto count = std::min(max_count, size());
+
+  // Slots until the wrap point.
+  auto slot = begin_ & mask_;
+  auto head = std::min(count, capacity_ - slot);
+
+  // Move up to the wrap point, then from the start of the buffer.
+  std::move(data_set_ptr_.get() + slot, data_set_ptr_.get() + slot + head, output);
+  std::move(data_set_ptr_.get(), data_set_ptr_.get() + (count - head), output + head);
+
+  // Advance front.
+  begin_ += count;
+
+  // Release memory if sparse.
+  shrink_if_sparse();
+
+  // Return.
+  return count;
+}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
 /**
  *
  * @details Returns maximum size of queue.
@@ -230,6 +418,22 @@ size_t QueueArray<T>::max() const
 //
 //  Class Member Implementation  ///////////////////////////////////////////////
 //
+/**
+ *
+ * @details Returns number of slots currently allocated.
+ *
+ * @return Number of slots currently allocated (a power of two).
+ *
+ */
+template<typename T>
+size_t QueueArray<T>::capacity() const
+{
+    // Return capacity.
+    return capacity_;
+}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
 /**
  *
  * @details Overloaded assignment operator.
@@ -238,28 +442,170 @@ size_t QueueArray<T>::max() const
  *
  */
 template<typename T>
-QueueArray<T> QueueArray<T>::operator=(const QueueArray<T>& rhs)
+QueueArray<T>& QueueArray<T>::operator=(const QueueArray<T>& rhs)
 {
-    // Should reallocate?
-    if (max_ != rhs.max_)
+    // Self-assignment?
+    if (this == &rhs)
     {
-        // Reallocate.
-        *data_set_ptr_.reset(new T[rhs.max_], [] (auto ptr) { delete[] ptr; });
+        // Return.
+        return *this;
     }
 
-    // Is pointer valid?
-    if (rhs.data_set_ptr_ != nullptr)
+    // Copy policy.
+    max_ = rhs.max_;
+    capacity_ = rhs.capacity_;
+    mask_ = rhs.mask_;
+    min_capacity_ = rhs.min_capacity_;
+    growth_ = rhs.growth_;
+
+    // Reallocate.
+    data_set_ptr_.reset(new T[capacity_], [] (auto ptr) { delete[] ptr; });
+
+    // Copy.
+    for (auto i = rhs.begin_; i < rhs.end_; i++)
     {
-        // Copy.
-        for (auto i = rhs.begin_; i < rhs.end_; i++)
-        {
-            // Copy item.
-            data_set_ptr_.get()[i % max_] = rhs.data_set_ptr_.get()[i % max_];
-        }
+        // Copy item.
+        data_set_ptr_.get()[i - rhs.begin_] = rhs.data_set_ptr_.get()[i & mask_];
+    }
+
+    // Reset indices.
+    begin_ = 0;
+    end_ = rhs.size();
+
+    // Return.
+    return *this;
+}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Makes sure count more items fit, doubling the capacity as needed
+ *          when the policy allows it.
+ *
+ * @param[in] count
+ *            Number of items about to be placed.
+ *
+ * @return Boolean value indicating whether count more items fit.
+ *
+ */
+template<typename T>
+bool QueueArray<T>::make_room(size_t count)
+{
+    // Beyond maximum size?
+    if (max_ - size() < count)
+    {
+        // Failure.
+        return false;
+    }
+
+    // Fits already?
+    if (capacity_ - size() >= count)
+    {
+        // Success.
+        return true;
+    }
+
+    // Double until it fits.
+    auto new_capacity = capacity_;
+    while (new_capacity - size() < count)
+    {
+        // Double.
+        new_capacity *= 2;
+    }
+
+    // Grow.
+    reallocate(new_capacity);
+
+    // Success.
+    return true;
+}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Halves the capacity when at most a quarter of it is in use, if the
+ *          policy allows it (never below the initial capacity).
+ *
+ */
+template<typename T>
+void QueueArray<T>::shrink_if_sparse()
+{
+    // Shrinking allowed and sparse?
+    if (
+        growth_ == QueueArrayGrowth::grow_and_shrink &&
+        capacity_ > min_capacity_ &&
+        size() * 4 <= capacity_
+    )
+    {
+        // Shrink.
+        reallocate(capacity_ / 2);
+    }
+}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Moves the items into a new buffer, front first, so FIFO order is
+ *          preserved and the front lands in slot 0.
+ *
+ * @param[in] new_capacity
+ *            Number of slots of the new buffer (a power of two, at least
+ *            size()).
+ *
+ */
+template<typename T>
+void QueueArray<T>::reallocate(size_t new_capacity)
+{
+    // New buffer.
+    auto new_data_ptr = std::shared_ptr< T >(new T[new_capacity], [] (auto ptr) { delete[] ptr; });
+
+    // Move items in order.
+    for (auto i = begin_; i < end_; i++)
+    {
+        // Move item.
+        new_data_ptr.get()[i - begin_] = std::move(data_set_ptr_.get()[i & mask_]);
+    }
+
+    // Reset indices.
+    end_ -= begin_;
+    begin_ = 0;
+
+    // Swap buffers.
+    data_set_ptr_ = new_data_ptr;
+    capacity_ = new_capacity;
+    mask_ = new_capacity - 1;
+}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Returns smallest power of two not less than value (at least 1).
+ *
+ * @param[in] value
+ *            Value to round up.
+ *
+ * @return Power of two.
+ *
+ */
+template<typename T>
+size_t QueueArray<T>::round_up_to_power_of_two(size_t value)
+{
+    // Start at one.
+    auto power = (size_t) 1;
+
+    // Double until large enough.
+    while (power < value)
+    {
+        // Double.
+        power *= 2;
     }
 
     // Return.
-    return this;
+    return power;
 }
 //
 //  Terminating Precompiler Directives  ////////////////////////////////////////
@@ -21,36 +21,62 @@
 #include <iterator>
 #include <utility>
 #include <memory>
+#include <algorithm>
 #include "Queue.h"
 //
+//  Type Definitions  //////////////////////////////////////////////////////////
+//
+enum class QueueArrayGrowth
+{
+  fixed, /**< Capacity never changes; enqueue fails when full */
+  grow, /**< Capacity doubles when full */
+  grow_and_shrink /**< Capacity doubles when full and halves when a quarter full (never below the initial capacity) */
+}; /**< Capacity policy of a QueueArray */
+//
 //  Class Definition  //////////////////////////////////////////////////////////
 //
 template<class T>
-class QueueArray : public Queue< T >
+class QueueArray final : public Queue< T >
 {
 
 // Public members.
 public:
-  QueueArray(size_t, std::shared_ptr< std::list< T > > data_ptr = std::shared_ptr< std::list< T > >(nullptr)); /**< Parameterized constructor */
+  QueueArray(size_t, std::shared_ptr< std::list< T > > data_ptr = std::shared_ptr< std::list< T > >(nullptr)); /**< Parameterized constructor (fixed capacity) */
+  QueueArray(size_t, QueueArrayGrowth); /**< Parameterized constructor */
   QueueArray(const QueueArray< T >&); /**< Copy constructor */
   ~QueueArray(); /**< Destructor */
 
   bool empty() const override; /**< Returns boolean indicating if queue is empty */
-  bool enqueue(T) override; /**< Places an item at the end of the queue and returns boolean indicating success */
+  bool enqueue(const T&) override; /**< Copies an item to the end of the queue and returns boolean indicating success */
+  bool enqueue(T&&) override; /**< Moves an item to the end of the queue and returns boolean indicating success */
   bool dequeue() override; /**< Removes and returns the item in the front of the queue */
   T peek() const override; /**< Returns the item in the front of the queue without modifying the data */
+  const T& front() const override; /**< Returns a reference to the item in the front of the queue */
+  bool try_pop(T&) override; /**< Moves the front item into the out parameter and removes it, returns boolean indicating success */
   size_t size() const override; /** Returns size of queue */
+  size_t enqueue_range(const T*, const T*) override; /**< Copies a contiguous range to the end of the queue and returns number of items placed */
+  size_t dequeue_batch(T*, size_t) override; /**< Moves up to n front items into an array, removes them, and returns number moved */
 
-  QueueArray<T> operator=(const QueueArray< T >&); /**< Overloaded assignment operator. */
+  size_t capacity() const; /**< Returns number of slots currently allocated */
+
+  QueueArray<T>& operator=(const QueueArray< T >&); /**< Overloaded assignment operator. */
 
 // Private members.
 private:
   size_t max() const; /**< Returns max size of queue */
-  
-  std::shared_ptr< T > data_set_ptr_; /**< Underlying data container */
-  size_t begin_; /**< Current front index */
+  bool make_room(size_t); /**< Grows (if allowed) so that count more items fit, returns boolean indicating success */
+  void shrink_if_sparse(); /**< Halves capacity (if allowed) when at most a quarter full */
+  void reallocate(size_t); /**< Moves the items, in order, into a buffer with a new power-of-two capacity */
+  static size_t round_up_to_power_of_two(size_t); /**< Returns smallest power of two not less than value */
+
+  std::shared_ptr< T > data_set_ptr_; /**< Underlying data container (ring buffer of capacity_ slots) */
+  size_t begin_; /**< Current front index (slot is begin_ & mask_) */
   size_t end_; /**< Current index indicating first out-of-bound index */
   size_t max_; /** Max size of queue */
+  size_t capacity_; /**< Number of allocated slots (a power of two) */
+  size_t mask_; /**< capacity_ - 1, maps an index to its slot */
+  size_t min_capacity_; /**< Capacity the queue never shrinks below */
+  QueueArrayGrowth growth_; /**< Capacity policy */
 
 };
 //
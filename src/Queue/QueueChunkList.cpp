@@ -0,0 +1,573 @@
+/**
+ *
+ * @file QueueChunkList.cpp
+ *
+ * @brief Templated queue with unrolled (chunked) linked list container
+ *
+ * @author Josh Wiley
+ *
+ * @details Implements the QueueChunkList class
+ *
+ */
+//
+//  Preprocessor Directives  ///////////////////////////////////////////////////
+//
+#ifndef QUEUE_CHUNK_LIST_CPP_
+#define QUEUE_CHUNK_LIST_CPP_
+//
+//  Header Files  //////////////////////////////////////////////////////////////
+//
+#include "QueueChunkList.h"
+//
+//  Static Member Definitions  /////////////////////////////////////////////////
+//
+template<typename T>
+const size_t QueueChunkList<T>::block_size;
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Initializes an empty queue (no blocks are allocated until the
+ *          first item arrives)
+ *
+ */
+template<typename T>
+QueueChunkList<T>::QueueChunkList()
+    : head_(nullptr), tail_(nullptr), free_(nullptr),
+      head_pos_(0), tail_pos_(0), size_(0) {}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Copies list as underlying data set
+ *
+ */
+template<typename T>
+QueueChunkList<T>::QueueChunkList(std::shared_ptr<std::list<T>> data_set_ptr)
+    : QueueChunkList()
+{
+    // Copy each item.
+    for (const auto& item : *data_set_ptr)
+    {
+        // Copy.
+        enqueue(item);
+    }
+}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Copy-initializes queue from another queue
+ *
+ */
+template<typename T>
+QueueChunkList<T>::QueueChunkList(const QueueChunkList<T>& origin)
+    : QueueChunkList()
+{
+    // Copy items.
+    append_all(origin);
+}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Destructor
+ *
+ */
+template<typename T>
+QueueChunkList<T>::~QueueChunkList() {}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Returns a boolean indicating whether or not the queue is empty
+ *
+ * @return Boolean value indicating whether or not the queue is empty
+ *
+ */
+template<typename T>
+bool QueueChunkList<T>::empty() const
+{
+  // Return empty status.
+  return size_ == 0;
+}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Copies an item to the end of the queue
+ *
+ * @param[in] input
+ *            Item to place at the end of the queue
+ *
+ * @return Boolean value indicating the success of the operation
+ *
+ */
+template<typename T>
+bool QueueChunkList<T>::enqueue(const T& input)
+{
+  // Place value.
+  *back_slot() = input;
+
+  // Increment end.
+  tail_pos_++;
+  size_++;
+
+  // Success.
+  return true;
+}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Moves an item to the end of the queue
+ *
+ * @param[in] input
+ *            Item to place at the end of the queue
+ *
+ * @return Boolean value indicating the success of the operation
+ *
+ */
+template<typename T>
+bool QueueChunkList<T>::enqueue(T&& input)
+{
+  // Place value.
+  *back_slot() = std::move(input);
+
+  // Increment end.
+  tail_pos_++;
+  size_++;
+
+  // Success.
+  return true;
+}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Removes the item at the front of the queue
+ *
+ * @return Boolean value indicating the success of the operation.
+ *
+ */
+template<typename T>
+bool QueueChunkList<T>::dequeue()
+{
+  // Empty?
+  if (empty())
+  {
+    // Return failure.
+    return false;
+  }
+
+  // Remove front.
+  pop_front(1);
+
+  // Return success.
+  return true;
+}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Returns a copy of the item at the front of the queue
+ *
+ * @return Item at the front of the queue
+ *
+ */
+template<typename T>
+T QueueChunkList<T>::peek() const
+{
+  // Return front item.
+  return head_->items[head_pos_];
+}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Returns a reference to the item at the front of the queue (valid
+ *          until the queue is next modified)
+ *
+ * @return Reference to the item at the front of the queue
+ *
+ */
+template<typename T>
+const T& QueueChunkList<T>::front() const
+{
+  // Return front item.
+  return head_->items[head_pos_];
+}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Moves the item at the front of the queue into the out parameter
+ *          and removes it
+ *
+ * @param[out] output
+ *             Assigned the item at the front of the queue
+ *
+ * @return Boolean value indicating the success of the operation
+ *
+ */
+template<typename T>
+bool QueueChunkList<T>::try_pop(T& output)
+{
+  // Empty?
+  if (empty())
+  {
+    // Return failure.
+    return false;
+  }
+
+  // Move out.
+  output = std::move(head_->items[head_pos_]);
+
+  // Remove front.
+  pop_front(1);
+
+  // Return success.
+  return true;
+}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Returns current size of queue.
+ *
+ * @return Current size of queue.
+ *
+ */
+template<typename T>
+size_t QueueChunkList<T>::size() const
+{
+  // Return size of queue.
+  return size_;
+}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Copies the range to the end of the queue, one block-sized run at
+ *          a time
+ *
+ * @param[in] first
+ *            Pointer to the first item to place
+ *
+ * @param[in] last
+ *            Pointer past the last item to place
+ *
+ * @return Number of items placed
+ *
+ */
+template<typename T>
+size_t QueueChunkList<T>::enqueue_range(const T* first, const T* last)
+{
+  // Number to place.
+  auto count = (size_t) (last - first);
+
+  // Fill blocks.
+  while (first != last)
+  {
+    // Slots left in the tail block.
+    auto slot = back_slot();
+    auto run = std::min((size_t) (last - first), block_size - tail_pos_);
+
+    // Copy run.
+    std::copy(first, first + run, slot);
+
+    // Advance.
+    first += run;
+    tail_pos_ += run;
+    size_ += run;
+  }
+
+  // Return.
+  return count;
+}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Moves up to max_count items from the front of the queue, one
+ *          block-sized run at a time
+ *
+ * @param[out] output
+ *             Array receiving the items, in queue order
+ *
+ * @param[in] max_count
+ *            Maximum number of items to move
+ *
+ * @return Number of items moved
+ *
+ */
+template<typename T>
+size_t QueueChunkList<T>::dequeue_batch(T* output, size_t max_count)
+{
+  // Number available.
+  auto count = std::min(max_count, size_);
+  auto moved = (size_t) 0;
+
+  // Drain blocks.
+  while (moved < count)
+  {
+    // Items left in the head block.
+    auto end = head_ == tail_ ? tail_pos_ : block_size;
+    auto run = std::min(count - moved, end - head_pos_);
+
+    // Move run.
+    std::move(head_->items + head_pos_, head_->items + head_pos_ + run, output + moved);
+
+    // Advance.
+    moved += run;
+    pop_front(run);
+  }
+
+  // Return.
+  return count;
+}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Returns number of blocks allocated, whether holding items or
+ *          waiting in the free list.
+ *
+ * @return Number of blocks allocated.
+ *
+ */
+template<typename T>
+size_t QueueChunkList<T>::block_count() const
+{
+  // Return block count.
+  return blocks_.size();
+}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Overloaded assignment operator (blocks already allocated are
+ *          reused).
+ *
+ * @return Reference to this object for chain assignments.
+ *
+ */
+template<typename T>
+QueueChunkList<T>& QueueChunkList<T>::operator=(const QueueChunkList<T>& rhs)
+{
+  // Self-assignment?
+  if (this == &rhs)
+  {
+    // Return.
+    return *this;
+  }
+
+  // Replace items.
+  clear();
+  append_all(rhs);
+
+  // Return.
+  return *this;
+}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Returns the slot after the back item, linking a block to the tail
+ *          when the tail block is full (the caller fills the slot and
+ *          advances tail_pos_ and size_).
+ *
+ * @return Pointer to the slot after the back item.
+ *
+ */
+template<typename T>
+T* QueueChunkList<T>::back_slot()
+{
+  // No blocks yet?
+  if (tail_ == nullptr)
+  {
+    // Start chain.
+    head_ = tail_ = acquire_block();
+    head_pos_ = tail_pos_ = 0;
+  }
+  // Tail block full?
+  else if (tail_pos_ == block_size)
+  {
+    // Link another block.
+    auto block = acquire_block();
+    tail_->next = block;
+    tail_ = block;
+    tail_pos_ = 0;
+  }
+
+  // Return slot.
+  return tail_->items + tail_pos_;
+}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Removes count front items, which must all lie in the head block;
+ *          a drained head block goes back to the free list, and an emptied
+ *          queue rewinds its last block so it is reused from the start.
+ *
+ * @param[in] count
+ *            Number of items to remove.
+ *
+ */
+template<typename T>
+void QueueChunkList<T>::pop_front(size_t count)
+{
+  // Advance front.
+  head_pos_ += count;
+  size_ -= count;
+
+  // Empty?
+  if (size_ == 0)
+  {
+    // Rewind the only block.
+    head_pos_ = tail_pos_ = 0;
+  }
+  // Head block drained?
+  else if (head_pos_ == block_size)
+  {
+    // Recycle it.
+    auto block = head_;
+    head_ = head_->next;
+    head_pos_ = 0;
+    release_block(block);
+  }
+}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Takes a block from the free list, allocating a new one only when
+ *          the free list is empty.
+ *
+ * @return Unlinked block.
+ *
+ */
+template<typename T>
+typename QueueChunkList<T>::Block* QueueChunkList<T>::acquire_block()
+{
+  // Free list empty?
+  if (free_ == nullptr)
+  {
+    // Allocate.
+    blocks_.emplace_back(new Block());
+    blocks_.back()->next = nullptr;
+
+    // Return.
+    return blocks_.back().get();
+  }
+
+  // Pop free list.
+  auto block = free_;
+  free_ = block->next;
+  block->next = nullptr;
+
+  // Return.
+  return block;
+}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Pushes a block onto the free list.
+ *
+ * @param[in] block
+ *            Block no longer holding items.
+ *
+ */
+template<typename T>
+void QueueChunkList<T>::release_block(Block* block)
+{
+  // Push free list.
+  block->next = free_;
+  free_ = block;
+}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Removes all items and returns every block to the free list.
+ *
+ */
+template<typename T>
+void QueueChunkList<T>::clear()
+{
+  // Recycle chain.
+  while (head_ != nullptr)
+  {
+    // Recycle head.
+    auto block = head_;
+    head_ = head_ == tail_ ? nullptr : head_->next;
+    release_block(block);
+  }
+
+  // Reset.
+  tail_ = nullptr;
+  head_pos_ = tail_pos_ = 0;
+  size_ = 0;
+}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Copies every item of another queue to the end of this queue, in
+ *          queue order.
+ *
+ * @param[in] origin
+ *            Queue to copy from.
+ *
+ */
+template<typename T>
+void QueueChunkList<T>::append_all(const QueueChunkList<T>& origin)
+{
+  // Cursor.
+  auto block = origin.head_;
+  auto pos = origin.head_pos_;
+
+  // Copy each item.
+  for (auto i = (size_t) 0; i < origin.size_; i++)
+  {
+    // Copy.
+    enqueue(block->items[pos]);
+
+    // Advance, crossing into the next block.
+    if (++pos == block_size)
+    {
+      // Next block.
+      block = block->next;
+      pos = 0;
+    }
+  }
+}
+//
+//  Terminating Precompiler Directives  ////////////////////////////////////////
+//
+#endif // QUEUE_CHUNK_LIST_CPP_
+//
@@ -0,0 +1,89 @@
+/**
+ *
+ * @file QueueChunkList.h
+ *
+ * @brief Templated queue with unrolled (chunked) linked list container
+ *
+ * @author Josh Wiley
+ *
+ * @details Defines the QueueChunkList class
+ *
+ */
+//
+//  Preprocessor Directives  ///////////////////////////////////////////////////
+//
+#ifndef QUEUE_CHUNK_LIST_H_
+#define QUEUE_CHUNK_LIST_H_
+//
+//  Header Files  //////////////////////////////////////////////////////////////
+//
+#include <list>
+#include <vector>
+#include <memory>
+#include <utility>
+#include <algorithm>
+#include "Queue.h"
+//
+//  Class Definition  //////////////////////////////////////////////////////////
+//
+template<class T>
+class QueueChunkList final : public Queue<T>
+{
+
+// Public members.
+public:
+  static const size_t block_size = 64; /**< Number of items per block */
+
+  QueueChunkList(); /**< Default constructor */
+  QueueChunkList(std::shared_ptr<std::list<T>>); /**< Parameterized constructor */
+  QueueChunkList(const QueueChunkList<T>&); /**< Copy constructor */
+  ~QueueChunkList(); /**< Destructor */
+
+  bool empty() const override; /**< Returns boolean indicating if queue is empty */
+  bool enqueue(const T&) override; /**< Copies an item to the end of the queue and returns boolean indicating success */
+  bool enqueue(T&&) override; /**< Moves an item to the end of the queue and returns boolean indicating success */
+  bool dequeue() override; /**< Removes and returns the item in the front of the queue */
+  T peek() const override; /**< Returns the item in the front of the queue without modifying the data */
+  const T& front() const override; /**< Returns a reference to the item in the front of the queue */
+  bool try_pop(T&) override; /**< Moves the front item into the out parameter and removes it, returns boolean indicating success */
+  size_t size() const override; /** Returns size of queue */
+  size_t enqueue_range(const T*, const T*) override; /**< Copies a contiguous range to the end of the queue and returns number of items placed */
+  size_t dequeue_batch(T*, size_t) override; /**< Moves up to n front items into an array, removes them, and returns number moved */
+
+  size_t block_count() const; /**< Returns number of blocks allocated (in use or pooled) */
+
+  QueueChunkList<T>& operator=(const QueueChunkList<T>&); /**< Overloaded assignment operator. */
+
+// Private members.
+private:
+  struct Block
+  {
+    T items[block_size]; /**< Item slots */
+    Block* next; /**< Next block toward the back of the queue (or the free list) */
+  }; /**< Fixed-size run of item slots */
+
+  T* back_slot(); /**< Returns the slot after the back item, linking a block if needed */
+  void pop_front(size_t); /**< Removes count front items (all within the head block), recycling it if drained */
+  Block* acquire_block(); /**< Takes a block from the free list, allocating if it is empty */
+  void release_block(Block*); /**< Returns a block to the free list */
+  void clear(); /**< Removes all items, recycling every block */
+  void append_all(const QueueChunkList<T>&); /**< Copies every item of another queue to the end, in order */
+
+  std::vector< std::unique_ptr< Block > > blocks_; /**< Owns every block allocated */
+  Block* head_; /**< Block holding the front item */
+  Block* tail_; /**< Block holding the back item */
+  Block* free_; /**< Singly-linked list of recycled blocks */
+  size_t head_pos_; /**< Slot of the front item in head_ */
+  size_t tail_pos_; /**< Slot after the back item in tail_ */
+  size_t size_; /**< Number of items */
+
+};
+//
+//  Implementation Files  //////////////////////////////////////////////////////
+//
+#include "QueueChunkList.cpp"
+//
+//  Terminating Precompiler Directives  ////////////////////////////////////////
+//
+#endif // QUEUE_CHUNK_LIST_H_
+//
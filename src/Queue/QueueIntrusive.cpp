@@ -0,0 +1,421 @@
+/**
+ *
+ * @file QueueIntrusive.cpp
+ *
+ * @brief Templated queue of indices linked through a shared next-index column
+ *
+ * @author Josh Wiley
+ *
+ * @details Implements the QueueIntrusive class
+ *
+ */
+//
+//  Preprocessor Directives  ///////////////////////////////////////////////////
+//
+#ifndef QUEUE_INTRUSIVE_CPP_
+#define QUEUE_INTRUSIVE_CPP_
+//
+//  Header Files  //////////////////////////////////////////////////////////////
+//
+#include "QueueIntrusive.h"
+//
+//  Static Member Definitions  /////////////////////////////////////////////////
+//
+template<typename T>
+const T QueueIntrusive<T>::npos;
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Initializes an empty queue without a link column; the simulation
+ *          attaches its own, otherwise one is created on first enqueue
+ *
+ */
+template<typename T>
+QueueIntrusive<T>::QueueIntrusive()
+    : links_(nullptr), head_(npos), tail_(npos), size_(0) {}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Initializes an empty queue over a link column that may be shared
+ *          with other queues, as long as an index waits in at most one of
+ *          them at a time
+ *
+ * @param[in] links_ptr
+ *            Next-index column (grown on demand)
+ *
+ */
+template<typename T>
+QueueIntrusive<T>::QueueIntrusive(std::shared_ptr< LinkColumn > links_ptr)
+    : links_(links_ptr), head_(npos), tail_(npos), size_(0) {}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Copy-initializes queue from another queue; the copy gets its own
+ *          copy of the link column so the two never disturb each other
+ *
+ */
+template<typename T>
+QueueIntrusive<T>::QueueIntrusive(const QueueIntrusive<T>& origin)
+    : links_(
+          origin.links_ == nullptr ?
+          nullptr :
+          std::make_shared< LinkColumn >(*origin.links_)
+      ),
+      head_(origin.head_), tail_(origin.tail_), size_(origin.size_) {}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Destructor
+ *
+ */
+template<typename T>
+QueueIntrusive<T>::~QueueIntrusive() {}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Returns a boolean indicating whether or not the queue is empty
+ *
+ * @return Boolean value indicating whether or not the queue is empty
+ *
+ */
+template<typename T>
+bool QueueIntrusive<T>::empty() const
+{
+  // Return empty status.
+  return size_ == 0;
+}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Links an index to the end of the queue (the index must not be
+ *          waiting in any queue sharing the link column)
+ *
+ * @param[in] input
+ *            Index to place at the end of the queue
+ *
+ * @return Boolean value indicating the success of the operation
+ *
+ */
+template<typename T>
+bool QueueIntrusive<T>::enqueue(const T& input)
+{
+  // Reserved value?
+  if (input == npos)
+  {
+    // Failure.
+    return false;
+  }
+
+  // No link column yet?
+  if (links_ == nullptr)
+  {
+    // Create one.
+    links_ = std::make_shared< LinkColumn >();
+  }
+
+  // Grow link column?
+  if (input >= links_->size())
+  {
+    // Grow.
+    links_->resize((size_t) input + 1, npos);
+  }
+
+  // Terminate.
+  (*links_)[input] = npos;
+
+  // Empty?
+  if (empty())
+  {
+    // Start lane.
+    head_ = input;
+  }
+  else
+  {
+    // Link behind back.
+    (*links_)[tail_] = input;
+  }
+
+  // Advance back.
+  tail_ = input;
+  size_++;
+
+  // Success.
+  return true;
+}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Links an index to the end of the queue (indices are trivially
+ *          copied, so this is the same as the copying version)
+ *
+ * @param[in] input
+ *            Index to place at the end of the queue
+ *
+ * @return Boolean value indicating the success of the operation
+ *
+ */
+template<typename T>
+bool QueueIntrusive<T>::enqueue(T&& input)
+{
+  // Link.
+  return enqueue(static_cast< const T& >(input));
+}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Removes the item at the front of the queue
+ *
+ * @return Boolean value indicating the success of the operation.
+ *
+ */
+template<typename T>
+bool QueueIntrusive<T>::dequeue()
+{
+  // Empty?
+  if (empty())
+  {
+    // Return failure.
+    return false;
+  }
+
+  // Follow link.
+  head_ = (*links_)[head_];
+  size_--;
+
+  // Emptied?
+  if (empty())
+  {
+    // Clear back.
+    tail_ = npos;
+  }
+
+  // Return success.
+  return true;
+}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Returns a copy of the item at the front of the queue
+ *
+ * @return Item at the front of the queue
+ *
+ */
+template<typename T>
+T QueueIntrusive<T>::peek() const
+{
+  // Return front item.
+  return head_;
+}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Returns a reference to the item at the front of the queue (valid
+ *          until the queue is next modified)
+ *
+ * @return Reference to the item at the front of the queue
+ *
+ */
+template<typename T>
+const T& QueueIntrusive<T>::front() const
+{
+  // Return front item.
+  return head_;
+}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Moves the item at the front of the queue into the out parameter
+ *          and removes it
+ *
+ * @param[out] output
+ *             Assigned the item at the front of the queue
+ *
+ * @return Boolean value indicating the success of the operation
+ *
+ */
+template<typename T>
+bool QueueIntrusive<T>::try_pop(T& output)
+{
+  // Empty?
+  if (empty())
+  {
+    // Return failure.
+    return false;
+  }
+
+  // Copy out.
+  output = head_;
+
+  // Remove front.
+  return dequeue();
+}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Returns current size of queue.
+ *
+ * @return Current size of queue.
+ *
+ */
+template<typename T>
+size_t QueueIntrusive<T>::size() const
+{
+  // Return size of queue.
+  return size_;
+}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Links each index of the range to the end of the queue, stopping
+ *          at the first that cannot be placed
+ *
+ * @param[in] first
+ *            Pointer to the first index to place
+ *
+ * @param[in] last
+ *            Pointer past the last index to place
+ *
+ * @return Number of indices placed
+ *
+ */
+template<typename T>
+size_t QueueIntrusive<T>::enqueue_range(const T* first, const T* last)
+{
+  // Count.
+  auto count = (size_t) 0;
+
+  // Link each.
+  while (first != last && enqueue(*first))
+  {
+    // Advance.
+    ++first;
+    count++;
+  }
+
+  // Return.
+  return count;
+}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Moves up to max_count items from the front of the queue by
+ *          walking the links
+ *
+ * @param[out] output
+ *             Array receiving the items, in queue order
+ *
+ * @param[in] max_count
+ *            Maximum number of items to move
+ *
+ * @return Number of items moved
+ *
+ */
+template<typename T>
+size_t QueueIntrusive<T>::dequeue_batch(T* output, size_t max_count)
+{
+  // Count.
+  auto count = (size_t) 0;
+
+  // Pop each.
+  while (count < max_count && try_pop(output[count]))
+  {
+    // Advance.
+    count++;
+  }
+
+  // Return.
+  return count;
+}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Switches the queue to another link column; only allowed while
+ *          the queue is empty, since its links live in the old column.
+ *
+ * @param[in] links_ptr
+ *            Next-index column (grown on demand).
+ *
+ * @return Boolean value indicating the success of the operation.
+ *
+ */
+template<typename T>
+bool QueueIntrusive<T>::attach(std::shared_ptr< LinkColumn > links_ptr)
+{
+  // Holding items?
+  if (!empty())
+  {
+    // Failure.
+    return false;
+  }
+
+  // Attach.
+  links_ = links_ptr;
+
+  // Success.
+  return true;
+}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Overloaded assignment operator (takes its own copy of the link
+ *          column, as the copy constructor does).
+ *
+ * @return Reference to this object for chain assignments.
+ *
+ */
+template<typename T>
+QueueIntrusive<T>& QueueIntrusive<T>::operator=(const QueueIntrusive<T>& rhs)
+{
+  // Self-assignment?
+  if (this == &rhs)
+  {
+    // Return.
+    return *this;
+  }
+
+  // Copy.
+  links_ = rhs.links_ == nullptr ? nullptr : std::make_shared< LinkColumn >(*rhs.links_);
+  head_ = rhs.head_;
+  tail_ = rhs.tail_;
+  size_ = rhs.size_;
+
+  // Return.
+  return *this;
+}
+//
+//  Terminating Precompiler Directives  ////////////////////////////////////////
+//
+#endif // QUEUE_INTRUSIVE_CPP_
+//
@@ -0,0 +1,73 @@
+/**
+ *
+ * @file QueueIntrusive.h
+ *
+ * @brief Templated queue of indices linked through a shared next-index column
+ *
+ * @author Josh Wiley
+ *
+ * @details Defines the QueueIntrusive class
+ *
+ */
+//
+//  Preprocessor Directives  ///////////////////////////////////////////////////
+//
+#ifndef QUEUE_INTRUSIVE_H_
+#define QUEUE_INTRUSIVE_H_
+//
+//  Header Files  //////////////////////////////////////////////////////////////
+//
+#include <vector>
+#include <memory>
+#include <limits>
+#include "Queue.h"
+#include "../Arena/ArenaAllocator.h"
+//
+//  Class Definition  //////////////////////////////////////////////////////////
+//
+template<class T>
+class QueueIntrusive final : public Queue<T>
+{
+
+// Public members.
+public:
+  static const T npos = std::numeric_limits< T >::max(); /**< Link value marking the end of a lane */
+  typedef std::vector< T, ArenaAllocator< T > > LinkColumn; /**< Next-index column (drawn from an arena, or the global heap by default) */
+
+  QueueIntrusive(); /**< Default constructor (link column is attached later or created on first use) */
+  QueueIntrusive(std::shared_ptr< LinkColumn >); /**< Parameterized constructor */
+  QueueIntrusive(const QueueIntrusive<T>&); /**< Copy constructor */
+  ~QueueIntrusive(); /**< Destructor */
+
+  bool empty() const override; /**< Returns boolean indicating if queue is empty */
+  bool enqueue(const T&) override; /**< Links an index to the end of the queue and returns boolean indicating success */
+  bool enqueue(T&&) override; /**< Links an index to the end of the queue and returns boolean indicating success */
+  bool dequeue() override; /**< Removes and returns the item in the front of the queue */
+  T peek() const override; /**< Returns the item in the front of the queue without modifying the data */
+  const T& front() const override; /**< Returns a reference to the item in the front of the queue */
+  bool try_pop(T&) override; /**< Moves the front item into the out parameter and removes it, returns boolean indicating success */
+  size_t size() const override; /** Returns size of queue */
+  size_t enqueue_range(const T*, const T*) override; /**< Links a contiguous range of indices to the end of the queue and returns number placed */
+  size_t dequeue_batch(T*, size_t) override; /**< Moves up to n front items into an array, removes them, and returns number moved */
+
+  bool attach(std::shared_ptr< LinkColumn >); /**< Switches an empty queue to another link column, returns boolean indicating success */
+
+  QueueIntrusive<T>& operator=(const QueueIntrusive<T>&); /**< Overloaded assignment operator. */
+
+// Private members.
+private:
+  std::shared_ptr< LinkColumn > links_; /**< Next index of each linked index, shared by every lane an index may wait in */
+  T head_; /**< Front index (npos when empty) */
+  T tail_; /**< Back index (npos when empty) */
+  size_t size_; /**< Number of items */
+
+};
+//
+//  Implementation Files  //////////////////////////////////////////////////////
+//
+#include "QueueIntrusive.cpp"
+//
+//  Terminating Precompiler Directives  ////////////////////////////////////////
+//
+#endif // QUEUE_INTRUSIVE_H_
+//
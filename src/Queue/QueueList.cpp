@@ -79,7 +79,7 @@ bool QueueList<T>::empty() const
 //
 /**
  *
- * @details Attempts to place an item at the end of the queue and returns a
+ * @details Attempts to copy an item to the end of the queue and returns a
  *          boolean value indicating the success of the operation
  *
  * @param[in] input
@@ -89,7 +89,7 @@ bool QueueList<T>::empty() const
  *
  */
 template<typename T>
-bool QueueList<T>::enqueue(T input)
+bool QueueList<T>::enqueue(const T& input)
 {
   // Push item to end of queue.
   data_set_.push_back(input);
@@ -100,6 +100,53 @@ bool QueueList<T>::enqueue(T input)
 //
 //  Class Member Implementation  ///////////////////////////////////////////////
 //
+/**
+ *
+ * @details Attempts to move an item to the end of the queue and returns a
+ *          boolean value indicating the success of the operation
+ *
+ * @param[in] input
+ *            Item to place at the end of the queue
+ *
+ * @return Boolean value indicating the success of the operation
+ *
+ */
+template<typename T>
+bool QueueList<T>::enqueue(T&& input)
+{
+  // Push item to end of queue.
+  data_set_.push_back(std::move(input));
+
+  // Always successful for this implementation.
+  return true;
+}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Constructs an item in place at the end of the queue and returns a
+ *          boolean value indicating the success of the operation
+ *
+ * @param[in] args
+ *            Arguments forwarded to the item's constructor
+ *
+ * @return Boolean value indicating the success of the operation
+ *
+ */
+template<typename T>
+template<typename ... A>
+bool QueueList<T>::emplace(A&& ... args)
+{
+  // Construct item at end of queue.
+  data_set_.emplace_back(std::forward< A >(args)...);
+
+  // Always successful for this implementation.
+  return true;
+}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
 /**
  *
  * @details Removes the item at the front of the queue
@@ -128,9 +175,9 @@ bool QueueList<T>::dequeue()
 //
 /**
  *
- * @details Removes the item at the front of the queue
+ * @details Returns a copy of the item at the front of the queue
  *
- * @return Boolean value indicating the success of the operation.
+ * @return Item at the front of the queue
  *
  */
 template<typename T>
@@ -142,6 +189,56 @@ T QueueList<T>::peek() const
 //
 //  Class Member Implementation  ///////////////////////////////////////////////
 //
+/**
+ *
+ * @details Returns a reference to the item at the front of the queue (valid
+ *          until the item is removed)
+ *
+ * @return Reference to the item at the front of the queue
+ *
+ */
+template<typename T>
+const T& QueueList<T>::front() const
+{
+  // Return front item.
+  return data_set_.front();
+}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Moves the item at the front of the queue into the out parameter
+ *          and removes it
+ *
+ * @param[out] output
+ *             Assigned the item at the front of the queue
+ *
+ * @return Boolean value indicating the success of the operation
+ *
+ */
+template<typename T>
+bool QueueList<T>::try_pop(T& output)
+{
+  // Empty?
+  if (empty())
+  {
+    // Return failure.
+    return false;
+  }
+
+  // Move out.
+  output = std::move(data_set_.front());
+
+  // Remove item.
+  data_set_.pop_front();
+
+  // Return success.
+  return true;
+}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
 /**
  *
  * @details Returns current size of queue.
@@ -156,6 +253,72 @@ size_t QueueList<T>::size() const
     return data_set_.size();
 }
 //
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Builds the range into a detached list and splices it onto the end
+ *          of the queue in one operation
+ *
+ * @param[in] first
+ *            Pointer to the first item to place
+ *
+ * @param[in] last
+ *            Pointer past the last item to place
+ *
+ * @return Number of items placed
+ *
+ */
+template<typename T>
+size_t QueueList<T>::enqueue_range(const T* first, const T* last)
+{
+  // Detached nodes.
+  auto items = std::list<T>(first, last);
+  auto count = items.size();
+
+  // Splice onto end.
+  data_set_.splice(data_set_.end(), items);
+
+  // Return.
+  return count;
+}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Moves up to max_count front items out, then splices their nodes
+ *          off the queue in one operation
+ *
+ * @param[out] output
+ *             Array receiving the items, in queue order
+ *
+ * @param[in] max_count
+ *            Maximum number of items to move
+ *
+ * @return Number of items moved
+ *
+ */
+template<typename T>
+size_t QueueList<T>::dequeue_batch(T* output, size_t max_count)
+{
+  // Number available.
+  auto count = std::min(max_count, data_set_.size());
+
+  // End of batch.
+  auto last_it = std::next(data_set_.begin(), count);
+
+  // Move items out.
+  std::move(data_set_.begin(), last_it, output);
+
+  // Splice nodes off (freed with the detached list).
+  auto removed = std::list<T>();
+  removed.splice(removed.end(), data_set_, data_set_.begin(), last_it);
+
+  // Return.
+  return count;
+}
+//
 //  Terminating Precompiler Directives  ////////////////////////////////////////
 //
 #endif // QUEUE_LIST_CPP_
@@ -19,12 +19,15 @@
 //
 #include <list>
 #include <memory>
+#include <utility>
+#include <algorithm>
+#include <iterator>
 #include "Queue.h"
 //
 //  Class Definition  //////////////////////////////////////////////////////////
 //
 template<class T>
-class QueueList : public Queue<T>
+class QueueList final : public Queue<T>
 {
 
 // Public members.
@@ -35,10 +38,17 @@ public:
   ~QueueList(); /**< Destructor */
 
   bool empty() const override; /**< Returns boolean indicating if queue is empty */
-  bool enqueue(T) override; /**< Places an item at the end of the queue and returns boolean indicating success */
+  bool enqueue(const T&) override; /**< Copies an item to the end of the queue and returns boolean indicating success */
+  bool enqueue(T&&) override; /**< Moves an item to the end of the queue and returns boolean indicating success */
+  template<class ... A>
+  bool emplace(A&& ...); /**< Constructs an item at the end of the queue and returns boolean indicating success */
   bool dequeue() override; /**< Removes and returns the item in the front of the queue */
   T peek() const override; /**< Returns the item in the front of the queue without modifying the data */
+  const T& front() const override; /**< Returns a reference to the item in the front of the queue */
+  bool try_pop(T&) override; /**< Moves the front item into the out parameter and removes it, returns boolean indicating success */
   size_t size() const override; /** Returns size of queue */
+  size_t enqueue_range(const T*, const T*) override; /**< Copies a contiguous range to the end of the queue and returns number of items placed */
+  size_t dequeue_batch(T*, size_t) override; /**< Moves up to n front items into an array, removes them, and returns number moved */
 
 // Private members.
 private:
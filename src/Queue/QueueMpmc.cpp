@@ -0,0 +1,415 @@
+/**
+ *
+ * @file QueueMpmc.cpp
+ *
+ * @brief Templated lock-free bounded multi-producer/multi-consumer queue
+ *
+ * @author Josh Wiley
+ *
+ * @details Implements the QueueMpmc class (Vyukov's bounded queue). Each
+ *          cell carries a sequence number; a producer may claim position pos
+ *          when its cell's sequence equals pos and a consumer when it equals
+ *          pos + 1. Claiming is a compare-and-swap on the shared position,
+ *          and publishing is a release store of the cell's next sequence, so
+ *          producers and consumers only contend with their own kind.
+ *
+ */
+//
+//  Preprocessor Directives  ///////////////////////////////////////////////////
+//
+#ifndef QUEUE_MPMC_CPP_
+#define QUEUE_MPMC_CPP_
+//
+//  Header Files  //////////////////////////////////////////////////////////////
+//
+#include "QueueMpmc.h"
+//
+//  Static Member Definitions  /////////////////////////////////////////////////
+//
+template<typename T>
+const size_t QueueMpmc<T>::cache_line_size;
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Allocates the ring, rounding the capacity up to a power of two
+ *          (at least 2), and numbers every cell free for its first lap
+ *
+ * @param[in] min_capacity
+ *            Minimum number of items the queue can hold at once
+ *
+ */
+template<typename T>
+QueueMpmc<T>::QueueMpmc(size_t min_capacity)
+    : capacity_(2), enqueue_pos_(0), dequeue_pos_(0)
+{
+    // Round up to a power of two.
+    while (capacity_ < min_capacity)
+    {
+        // Double.
+        capacity_ *= 2;
+    }
+
+    // Allocate.
+    mask_ = capacity_ - 1;
+    cells_.reset(new Cell[capacity_]);
+
+    // Number cells.
+    for (auto i = (size_t) 0; i < capacity_; i++)
+    {
+        // Free for position i.
+        cells_[i].sequence.store(i, std::memory_order_relaxed);
+    }
+}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Destructor
+ *
+ */
+template<typename T>
+QueueMpmc<T>::~QueueMpmc() {}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Returns a boolean indicating whether or not the front cell is
+ *          still unfilled
+ *
+ * @return Boolean value indicating whether or not the queue is empty
+ *
+ */
+template<typename T>
+bool QueueMpmc<T>::empty() const
+{
+  // Front position.
+  auto pos = dequeue_pos_.load(std::memory_order_acquire);
+
+  // Return empty status.
+  return cells_[pos & mask_].sequence.load(std::memory_order_acquire) != pos + 1;
+}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Attempts to copy an item to the end of the queue and returns a
+ *          boolean value indicating the success of the operation
+ *
+ * @param[in] input
+ *            Item to place at the end of the queue
+ *
+ * @return Boolean value indicating the success of the operation
+ *
+ */
+template<typename T>
+bool QueueMpmc<T>::enqueue(const T& input)
+{
+  // Push copy.
+  return push(input);
+}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Attempts to move an item to the end of the queue and returns a
+ *          boolean value indicating the success of the operation
+ *
+ * @param[in] input
+ *            Item to place at the end of the queue
+ *
+ * @return Boolean value indicating the success of the operation
+ *
+ */
+template<typename T>
+bool QueueMpmc<T>::enqueue(T&& input)
+{
+  // Push moved.
+  return push(std::move(input));
+}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Removes the item at the front of the queue
+ *
+ * @return Boolean value indicating the success of the operation.
+ *
+ */
+template<typename T>
+bool QueueMpmc<T>::dequeue()
+{
+  // Discarded item.
+  auto item = T();
+
+  // Pop.
+  return try_pop(item);
+}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Returns a copy of the item at the front of the queue
+ *
+ * @return Item at the front of the queue
+ *
+ */
+template<typename T>
+T QueueMpmc<T>::peek() const
+{
+  // Return front item.
+  return front();
+}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Returns a reference to the item at the front of the queue; only
+ *          meaningful if empty() just returned false and no other thread
+ *          dequeues until the reference is dropped
+ *
+ * @return Reference to the item at the front of the queue
+ *
+ */
+template<typename T>
+const T& QueueMpmc<T>::front() const
+{
+  // Return front item.
+  return cells_[dequeue_pos_.load(std::memory_order_relaxed) & mask_].data;
+}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Claims the front cell, moves its item into the out parameter, and
+ *          frees the cell for the producer one lap ahead
+ *
+ * @param[out] output
+ *             Assigned the item at the front of the queue
+ *
+ * @return Boolean value indicating the success of the operation
+ *
+ */
+template<typename T>
+bool QueueMpmc<T>::try_pop(T& output)
+{
+  // Front position.
+  auto pos = dequeue_pos_.load(std::memory_order_relaxed);
+  auto cell = &cells_[0];
+
+  // Claim a filled cell.
+  while (true)
+  {
+    // Cell state relative to this position.
+    cell = &cells_[pos & mask_];
+    auto sequence = cell->sequence.load(std::memory_order_acquire);
+    auto diff = (std::intptr_t) sequence - (std::intptr_t) (pos + 1);
+
+    // Filled for this position?
+    if (diff == 0)
+    {
+      // Claim (pos is reloaded on failure).
+      if (dequeue_pos_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+      {
+        // Claimed.
+        break;
+      }
+    }
+    // Not filled yet?
+    else if (diff < 0)
+    {
+      // Empty.
+      return false;
+    }
+    // Another consumer claimed it.
+    else
+    {
+      // Reload.
+      pos = dequeue_pos_.load(std::memory_order_relaxed);
+    }
+  }
+
+  // Move out, then free the cell for the next lap.
+  output = std::move(cell->data);
+  cell->sequence.store(pos + capacity_, std::memory_order_release);
+
+  // Return success.
+  return true;
+}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Returns current size of queue (claimed positions, so it may count
+ *          items still being written or read under concurrency).
+ *
+ * @return Current size of queue.
+ *
+ */
+template<typename T>
+size_t QueueMpmc<T>::size() const
+{
+  // Consumer position first, so the difference never goes negative.
+  auto head = dequeue_pos_.load(std::memory_order_acquire);
+  auto tail = enqueue_pos_.load(std::memory_order_acquire);
+
+  // Return size of queue.
+  return tail > head ? tail - head : 0;
+}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Pushes items of the range in order until the queue is full (other
+ *          producers' items may interleave with them)
+ *
+ * @param[in] first
+ *            Pointer to the first item to place
+ *
+ * @param[in] last
+ *            Pointer past the last item to place
+ *
+ * @return Number of items placed
+ *
+ */
+template<typename T>
+size_t QueueMpmc<T>::enqueue_range(const T* first, const T* last)
+{
+  // Count.
+  auto count = (size_t) 0;
+
+  // Push each.
+  while (first != last && push(*first))
+  {
+    // Advance.
+    ++first;
+    count++;
+  }
+
+  // Return.
+  return count;
+}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Pops up to max_count items until the queue is empty
+ *
+ * @param[out] output
+ *             Array receiving the items, in the order they were popped
+ *
+ * @param[in] max_count
+ *            Maximum number of items to move
+ *
+ * @return Number of items moved
+ *
+ */
+template<typename T>
+size_t QueueMpmc<T>::dequeue_batch(T* output, size_t max_count)
+{
+  // Count.
+  auto count = (size_t) 0;
+
+  // Pop each.
+  while (count < max_count && try_pop(output[count]))
+  {
+    // Advance.
+    count++;
+  }
+
+  // Return.
+  return count;
+}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Returns number of cells in the ring.
+ *
+ * @return Number of cells in the ring (a power of two).
+ *
+ */
+template<typename T>
+size_t QueueMpmc<T>::capacity() const
+{
+  // Return capacity.
+  return capacity_;
+}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Claims the back cell, fills it, and publishes it to consumers.
+ *
+ * @param[in] input
+ *            Item to place, forwarded as copy or move.
+ *
+ * @return Boolean value indicating the success of the operation.
+ *
+ */
+template<typename T>
+template<class U>
+bool QueueMpmc<T>::push(U&& input)
+{
+  // Back position.
+  auto pos = enqueue_pos_.load(std::memory_order_relaxed);
+  auto cell = &cells_[0];
+
+  // Claim a free cell.
+  while (true)
+  {
+    // Cell state relative to this position.
+    cell = &cells_[pos & mask_];
+    auto sequence = cell->sequence.load(std::memory_order_acquire);
+    auto diff = (std::intptr_t) sequence - (std::intptr_t) pos;
+
+    // Free for this position?
+    if (diff == 0)
+    {
+      // Claim (pos is reloaded on failure).
+      if (enqueue_pos_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+      {
+        // Claimed.
+        break;
+      }
+    }
+    // Still holding last lap's item?
+    else if (diff < 0)
+    {
+      // Full.
+      return false;
+    }
+    // Another producer claimed it.
+    else
+    {
+      // Reload.
+      pos = enqueue_pos_.load(std::memory_order_relaxed);
+    }
+  }
+
+  // Fill, then publish the cell.
+  cell->data = std::forward< U >(input);
+  cell->sequence.store(pos + 1, std::memory_order_release);
+
+  // Success.
+  return true;
+}
+//
+//  Terminating Precompiler Directives  ////////////////////////////////////////
+//
+#endif // QUEUE_MPMC_CPP_
+//
@@ -0,0 +1,82 @@
+/**
+ *
+ * @file QueueMpmc.h
+ *
+ * @brief Templated lock-free bounded multi-producer/multi-consumer queue
+ *
+ * @author Josh Wiley
+ *
+ * @details Defines the QueueMpmc class
+ *
+ */
+//
+//  Preprocessor Directives  ///////////////////////////////////////////////////
+//
+#ifndef QUEUE_MPMC_H_
+#define QUEUE_MPMC_H_
+//
+//  Header Files  //////////////////////////////////////////////////////////////
+//
+#include <atomic>
+#include <memory>
+#include <utility>
+#include <cstdint>
+#include "Queue.h"
+//
+//  Class Definition  //////////////////////////////////////////////////////////
+//
+template<class T>
+class QueueMpmc final : public Queue<T>
+{
+
+// Public members.
+public:
+  static const size_t cache_line_size = 64; /**< Alignment that keeps the producer and consumer positions on separate lines */
+
+  QueueMpmc(size_t); /**< Parameterized constructor */
+  QueueMpmc(const QueueMpmc<T>&) = delete; /**< Not copyable (shared between threads) */
+  ~QueueMpmc(); /**< Destructor */
+
+  bool empty() const override; /**< Returns boolean indicating if queue is empty (a snapshot under concurrency) */
+  bool enqueue(const T&) override; /**< Copies an item to the end of the queue and returns boolean indicating success */
+  bool enqueue(T&&) override; /**< Moves an item to the end of the queue and returns boolean indicating success */
+  bool dequeue() override; /**< Removes the item in the front of the queue */
+  T peek() const override; /**< Returns the item in the front of the queue without modifying the data (only while no other thread dequeues) */
+  const T& front() const override; /**< Returns a reference to the item in the front of the queue (only while no other thread dequeues) */
+  bool try_pop(T&) override; /**< Moves the front item into the out parameter and removes it, returns boolean indicating success */
+  size_t size() const override; /** Returns size of queue (a snapshot under concurrency) */
+  size_t enqueue_range(const T*, const T*) override; /**< Copies items of a contiguous range to the end of the queue until full and returns number placed */
+  size_t dequeue_batch(T*, size_t) override; /**< Moves up to n front items into an array, removes them, and returns number moved */
+
+  size_t capacity() const; /**< Returns number of cells */
+
+  QueueMpmc<T>& operator=(const QueueMpmc<T>&) = delete; /**< Not assignable (shared between threads) */
+
+// Private members.
+private:
+  struct Cell
+  {
+    std::atomic< size_t > sequence; /**< Position the cell is ready for: pos when free for the producer claiming pos, pos + 1 once filled */
+    T data; /**< Item */
+  }; /**< Sequence-numbered slot */
+
+  template<class U>
+  bool push(U&&); /**< Claims the back cell, fills it, and publishes it, if the queue is not full */
+
+  std::unique_ptr< Cell[] > cells_; /**< Ring of cells (capacity_ cells, a power of two) */
+  size_t capacity_; /**< Number of cells */
+  size_t mask_; /**< capacity_ - 1, maps a position to its cell */
+
+  alignas(cache_line_size) std::atomic< size_t > enqueue_pos_; /**< Next position to be claimed by a producer */
+  alignas(cache_line_size) std::atomic< size_t > dequeue_pos_; /**< Next position to be claimed by a consumer */
+
+};
+//
+//  Implementation Files  //////////////////////////////////////////////////////
+//
+#include "QueueMpmc.cpp"
+//
+//  Terminating Precompiler Directives  ////////////////////////////////////////
+//
+#endif // QUEUE_MPMC_H_
+//
@@ -0,0 +1,476 @@
+/**
+ *
+ * @file QueueSpsc.cpp
+ *
+ * @brief Templated lock-free single-producer/single-consumer ring queue
+ *
+ * @author Josh Wiley
+ *
+ * @details Implements the QueueSpsc class. Exactly one thread may call the
+ *          producer-side members and exactly one (possibly other) thread the
+ *          consumer-side members. The producer publishes slots with a release
+ *          store of the tail and the consumer frees them with a release store
+ *          of the head; each side keeps a cached copy of the other's index
+ *          and only reloads it when the cache says the ring is full or empty.
+ *
+ */
+//
+//  Preprocessor Directives  ///////////////////////////////////////////////////
+//
+#ifndef QUEUE_SPSC_CPP_
+#define QUEUE_SPSC_CPP_
+//
+//  Header Files  //////////////////////////////////////////////////////////////
+//
+#include "QueueSpsc.h"
+//
+//  Static Member Definitions  /////////////////////////////////////////////////
+//
+template<typename T>
+const size_t QueueSpsc<T>::cache_line_size;
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Allocates the ring, rounding the capacity up to a power of two
+ *
+ * @param[in] min_capacity
+ *            Minimum number of items the queue can hold at once
+ *
+ */
+template<typename T>
+QueueSpsc<T>::QueueSpsc(size_t min_capacity)
+    : capacity_(1), head_(0), cached_tail_(0), tail_(0), cached_head_(0), closed_(false)
+{
+    // Round up to a power of two.
+    while (capacity_ < min_capacity)
+    {
+        // Double.
+        capacity_ *= 2;
+    }
+
+    // Allocate.
+    mask_ = capacity_ - 1;
+    slots_.reset(new T[capacity_]);
+}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Destructor
+ *
+ */
+template<typename T>
+QueueSpsc<T>::~QueueSpsc() {}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Returns a boolean indicating whether or not the queue is empty
+ *
+ * @return Boolean value indicating whether or not the queue is empty
+ *
+ */
+template<typename T>
+bool QueueSpsc<T>::empty() const
+{
+  // Return empty status.
+  return head_.load(std::memory_order_relaxed) == tail_.load(std::memory_order_acquire);
+}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Attempts to copy an item to the end of the queue and returns a
+ *          boolean value indicating the success of the operation
+ *
+ * @param[in] input
+ *            Item to place at the end of the queue
+ *
+ * @return Boolean value indicating the success of the operation
+ *
+ */
+template<typename T>
+bool QueueSpsc<T>::enqueue(const T& input)
+{
+  // Push copy.
+  return push(input);
+}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Attempts to move an item to the end of the queue and returns a
+ *          boolean value indicating the success of the operation
+ *
+ * @param[in] input
+ *            Item to place at the end of the queue
+ *
+ * @return Boolean value indicating the success of the operation
+ *
+ */
+template<typename T>
+bool QueueSpsc<T>::enqueue(T&& input)
+{
+  // Push moved.
+  return push(std::move(input));
+}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Removes the item at the front of the queue
+ *
+ * @return Boolean value indicating the success of the operation.
+ *
+ */
+template<typename T>
+bool QueueSpsc<T>::dequeue()
+{
+  // Front index.
+  auto head = (size_t) 0;
+
+  // Empty?
+  if (!reserve_pop(head))
+  {
+    // Return failure.
+    return false;
+  }
+
+  // Free slot.
+  head_.store(head + 1, std::memory_order_release);
+
+  // Return success.
+  return true;
+}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Returns a copy of the item at the front of the queue
+ *
+ * @return Item at the front of the queue
+ *
+ */
+template<typename T>
+T QueueSpsc<T>::peek() const
+{
+  // Return front item.
+  return front();
+}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Returns a reference to the item at the front of the queue (only
+ *          meaningful if empty() just returned false on the consumer thread)
+ *
+ * @return Reference to the item at the front of the queue
+ *
+ */
+template<typename T>
+const T& QueueSpsc<T>::front() const
+{
+  // Return front item.
+  return slots_[head_.load(std::memory_order_relaxed) & mask_];
+}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Moves the item at the front of the queue into the out parameter
+ *          and removes it
+ *
+ * @param[out] output
+ *             Assigned the item at the front of the queue
+ *
+ * @return Boolean value indicating the success of the operation
+ *
+ */
+template<typename T>
+bool QueueSpsc<T>::try_pop(T& output)
+{
+  // Front index.
+  auto head = (size_t) 0;
+
+  // Empty?
+  if (!reserve_pop(head))
+  {
+    // Return failure.
+    return false;
+  }
+
+  // Move out, then free slot.
+  output = std::move(slots_[head & mask_]);
+  head_.store(head + 1, std::memory_order_release);
+
+  // Return success.
+  return true;
+}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Returns current size of queue (a snapshot that may be stale by
+ *          the time it is used if the other side is active).
+ *
+ * @return Current size of queue.
+ *
+ */
+template<typename T>
+size_t QueueSpsc<T>::size() const
+{
+  // Head first, so the difference never goes negative.
+  auto head = head_.load(std::memory_order_acquire);
+  auto tail = tail_.load(std::memory_order_acquire);
+
+  // Return size of queue.
+  return tail - head;
+}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Copies as much of the range as fits to the end of the queue and
+ *          publishes it with a single release store
+ *
+ * @param[in] first
+ *            Pointer to the first item to place
+ *
+ * @param[in] last
+ *            Pointer past the last item to place
+ *
+ * @return Number of items placed
+ *
+ */
+template<typename T>
+size_t QueueSpsc<T>::enqueue_range(const T* first, const T* last)
+{
+  // Own index, and a fresh view of the consumer for the whole run.
+  auto tail = tail_.load(std::memory_order_relaxed);
+  cached_head_ = head_.load(std::memory_order_acquire);
+
+  // Number that fit.
+  auto count = std::min((size_t) (last - first), capacity_ - (tail - cached_head_));
+
+  // Slots until the wrap point.
+  auto slot = tail & mask_;
+  auto run = std::min(count, capacity_ - slot);
+
+  // Copy up to the wrap point, then from the start of the ring.
+  std::copy(first, first + run, slots_.get() + slot);
+  std::copy(first + run, first + count, slots_.get());
+
+  // Publish.
+  tail_.store(tail + count, std::memory_order_release);
+
+  // Return.
+  return count;
+}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Moves up to max_count ready items from the front of the queue and
+ *          frees their slots with a single release store
+ *
+ * @param[out] output
+ *             Array receiving the items, in queue order
+ *
+ * @param[in] max_count
+ *            Maximum number of items to move
+ *
+ * @return Number of items moved
+ *
+ */
+template<typename T>
+size_t QueueSpsc<T>::dequeue_batch(T* output, size_t max_count)
+{
+  // Own index, and a fresh view of the producer for the whole run.
+  auto head = head_.load(std::memory_order_relaxed);
+  cached_tail_ = tail_.load(std::memory_order_acquire);
+
+  // Number ready.
+  auto count = std::min(max_count, cached_tail_ - head);
+
+  // Slots until the wrap point.
+  auto slot = head & mask_;
+  auto run = std::min(count, capacity_ - slot);
+
+  // Move up to the wrap point, then from the start of the ring.
+  std::move(slots_.get() + slot, slots_.get() + slot + run, output);
+  std::move(slots_.get(), slots_.get() + (count - run), output + run);
+
+  // Free slots.
+  head_.store(head + count, std::memory_order_release);
+
+  // Return.
+  return count;
+}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Returns number of slots in the ring.
+ *
+ * @return Number of slots in the ring (a power of two).
+ *
+ */
+template<typename T>
+size_t QueueSpsc<T>::capacity() const
+{
+  // Return capacity.
+  return capacity_;
+}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Marks the end of the stream; items enqueued before the call are
+ *          visible to a consumer that sees closed() return true.
+ *
+ */
+template<typename T>
+void QueueSpsc<T>::close()
+{
+  // Publish end of stream.
+  closed_.store(true, std::memory_order_release);
+}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Returns a boolean indicating whether or not the producer has
+ *          closed the stream (the queue may still hold items).
+ *
+ * @return Boolean value indicating whether or not the stream is closed.
+ *
+ */
+template<typename T>
+bool QueueSpsc<T>::closed() const
+{
+  // Return closed status.
+  return closed_.load(std::memory_order_acquire);
+}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Places one item in the slot after the back item and publishes it.
+ *
+ * @param[in] input
+ *            Item to place, forwarded as copy or move.
+ *
+ * @return Boolean value indicating the success of the operation.
+ *
+ */
+template<typename T>
+template<class U>
+bool QueueSpsc<T>::push(U&& input)
+{
+  // Back index.
+  auto tail = (size_t) 0;
+
+  // Full?
+  if (!reserve_push(tail))
+  {
+    // Failure.
+    return false;
+  }
+
+  // Fill, then publish slot.
+  slots_[tail & mask_] = std::forward< U >(input);
+  tail_.store(tail + 1, std::memory_order_release);
+
+  // Success.
+  return true;
+}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Loads the producer's own tail and checks for a free slot against
+ *          its cached head, reloading the head only if the cache says the
+ *          ring is full.
+ *
+ * @param[out] tail
+ *             Assigned the producer's tail.
+ *
+ * @return Boolean value indicating whether a slot is free.
+ *
+ */
+template<typename T>
+bool QueueSpsc<T>::reserve_push(size_t& tail)
+{
+  // Own index.
+  tail = tail_.load(std::memory_order_relaxed);
+
+  // Room according to the cache?
+  if (tail - cached_head_ != capacity_)
+  {
+    // Success.
+    return true;
+  }
+
+  // Refresh view of the consumer.
+  cached_head_ = head_.load(std::memory_order_acquire);
+
+  // Return room.
+  return tail - cached_head_ != capacity_;
+}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Loads the consumer's own head and checks for a ready item against
+ *          its cached tail, reloading the tail only if the cache says the
+ *          ring is empty.
+ *
+ * @param[out] head
+ *             Assigned the consumer's head.
+ *
+ * @return Boolean value indicating whether an item is ready.
+ *
+ */
+template<typename T>
+bool QueueSpsc<T>::reserve_pop(size_t& head)
+{
+  // Own index.
+  head = head_.load(std::memory_order_relaxed);
+
+  // Ready according to the cache?
+  if (head != cached_tail_)
+  {
+    // Success.
+    return true;
+  }
+
+  // Refresh view of the producer.
+  cached_tail_ = tail_.load(std::memory_order_acquire);
+
+  // Return readiness.
+  return head != cached_tail_;
+}
+//
+//  Terminating Precompiler Directives  ////////////////////////////////////////
+//
+#endif // QUEUE_SPSC_CPP_
+//
@@ -0,0 +1,85 @@
+/**
+ *
+ * @file QueueSpsc.h
+ *
+ * @brief Templated lock-free single-producer/single-consumer ring queue
+ *
+ * @author Josh Wiley
+ *
+ * @details Defines the QueueSpsc class
+ *
+ */
+//
+//  Preprocessor Directives  ///////////////////////////////////////////////////
+//
+#ifndef QUEUE_SPSC_H_
+#define QUEUE_SPSC_H_
+//
+//  Header Files  //////////////////////////////////////////////////////////////
+//
+#include <atomic>
+#include <memory>
+#include <utility>
+#include <algorithm>
+#include "Queue.h"
+//
+//  Class Definition  //////////////////////////////////////////////////////////
+//
+template<class T>
+class QueueSpsc final : public Queue<T>
+{
+
+// Public members.
+public:
+  static const size_t cache_line_size = 64; /**< Alignment that keeps the producer and consumer indices on separate lines */
+
+  QueueSpsc(size_t); /**< Parameterized constructor */
+  QueueSpsc(const QueueSpsc<T>&) = delete; /**< Not copyable (shared between threads) */
+  ~QueueSpsc(); /**< Destructor */
+
+  bool empty() const override; /**< Returns boolean indicating if queue is empty (consumer side) */
+  bool enqueue(const T&) override; /**< Copies an item to the end of the queue and returns boolean indicating success (producer side) */
+  bool enqueue(T&&) override; /**< Moves an item to the end of the queue and returns boolean indicating success (producer side) */
+  bool dequeue() override; /**< Removes the item in the front of the queue (consumer side) */
+  T peek() const override; /**< Returns the item in the front of the queue without modifying the data (consumer side) */
+  const T& front() const override; /**< Returns a reference to the item in the front of the queue (consumer side) */
+  bool try_pop(T&) override; /**< Moves the front item into the out parameter and removes it, returns boolean indicating success (consumer side) */
+  size_t size() const override; /** Returns size of queue (approximate while both sides are active) */
+  size_t enqueue_range(const T*, const T*) override; /**< Copies a contiguous range to the end of the queue and returns number of items placed (producer side) */
+  size_t dequeue_batch(T*, size_t) override; /**< Moves up to n front items into an array, removes them, and returns number moved (consumer side) */
+
+  size_t capacity() const; /**< Returns number of slots */
+  void close(); /**< Marks the end of the stream (producer side, after the last enqueue) */
+  bool closed() const; /**< Returns boolean indicating if the producer has closed the stream */
+
+  QueueSpsc<T>& operator=(const QueueSpsc<T>&) = delete; /**< Not assignable (shared between threads) */
+
+// Private members.
+private:
+  template<class U>
+  bool push(U&&); /**< Places one item at the back if there is room */
+  bool reserve_push(size_t&); /**< Returns the producer's tail if a slot is free, refreshing its view of the head if needed */
+  bool reserve_pop(size_t&); /**< Returns the consumer's head if an item is ready, refreshing its view of the tail if needed */
+
+  std::unique_ptr< T[] > slots_; /**< Ring buffer (capacity_ slots, a power of two) */
+  size_t capacity_; /**< Number of slots */
+  size_t mask_; /**< capacity_ - 1, maps an index to its slot */
+
+  alignas(cache_line_size) std::atomic< size_t > head_; /**< Index of the front item (written by the consumer) */
+  size_t cached_tail_; /**< Consumer's last view of tail_ */
+
+  alignas(cache_line_size) std::atomic< size_t > tail_; /**< Index after the back item (written by the producer) */
+  size_t cached_head_; /**< Producer's last view of head_ */
+
+  alignas(cache_line_size) std::atomic< bool > closed_; /**< Set by the producer after its last enqueue */
+
+};
+//
+//  Implementation Files  //////////////////////////////////////////////////////
+//
+#include "QueueSpsc.cpp"
+//
+//  Terminating Precompiler Directives  ////////////////////////////////////////
+//
+#endif // QUEUE_SPSC_H_
+//
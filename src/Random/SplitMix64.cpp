@@ -0,0 +1,112 @@
+/**
+ *
+ * @file SplitMix64.cpp
+ *
+ * @brief SplitMix64 generator, for expanding one seed into many
+ *
+ * @author Josh Wiley
+ *
+ * @details Implements the SplitMix64 class (Steele, Lea, and Flood). The
+ *          state is a counter stepped by an odd constant and every output is
+ *          the counter scrambled, so output i can be computed directly and
+ *          nearby seeds give unrelated outputs. Used to seed the xoshiro
+ *          engines and to derive per-replication and per-trace seeds.
+ *
+ */
+//
+//  Preprocessor Directives  ///////////////////////////////////////////////////
+//
+#ifndef SPLIT_MIX_64_CPP_
+#define SPLIT_MIX_64_CPP_
+#define GOLDEN_GAMMA (std::uint64_t) 0x9E3779B97F4A7C15ull
+//
+//  Header Files  //////////////////////////////////////////////////////////////
+//
+#include "SplitMix64.h"
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Parameterized constructor
+ *
+ * @param[in] seed
+ *            Initial counter
+ *
+ */
+SplitMix64::SplitMix64(std::uint64_t seed) : state_(seed) {}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Destructor
+ *
+ */
+SplitMix64::~SplitMix64() {}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Steps the counter and returns it scrambled
+ *
+ * @return Next output
+ *
+ */
+std::uint64_t SplitMix64::next()
+{
+    // Step.
+    state_ += GOLDEN_GAMMA;
+
+    // Return.
+    return mix(state_);
+}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Returns an output of a sequence directly from its index
+ *
+ * @param[in] seed
+ *            Seed of the sequence
+ *
+ * @param[in] index
+ *            Index of the output (0 for the first next())
+ *
+ * @return Output at the index
+ *
+ */
+std::uint64_t SplitMix64::at(std::uint64_t seed, std::uint64_t index)
+{
+    // Return.
+    return mix(seed + GOLDEN_GAMMA * (index + 1));
+}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Scrambles 64 bits (a variant of MurmurHash3's finalizer)
+ *
+ * @param[in] z
+ *            Bits to scramble
+ *
+ * @return Scrambled bits
+ *
+ */
+std::uint64_t SplitMix64::mix(std::uint64_t z)
+{
+    // Mix.
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+
+    // Return.
+    return z ^ (z >> 31);
+}
+//
+//  Terminating Precompiler Directives  ////////////////////////////////////////
+//
+#endif // SPLIT_MIX_64_CPP_
+//
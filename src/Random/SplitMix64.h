@@ -0,0 +1,49 @@
+/**
+ *
+ * @file SplitMix64.h
+ *
+ * @brief SplitMix64 generator, for expanding one seed into many
+ *
+ * @author Josh Wiley
+ *
+ * @details Defines the SplitMix64 class
+ *
+ */
+//
+//  Preprocessor Directives  ///////////////////////////////////////////////////
+//
+#ifndef SPLIT_MIX_64_H_
+#define SPLIT_MIX_64_H_
+//
+//  Header Files  //////////////////////////////////////////////////////////////
+//
+#include <cstdint>
+//
+//  Class Definition  //////////////////////////////////////////////////////////
+//
+class SplitMix64
+{
+
+// Public members.
+public:
+    SplitMix64(std::uint64_t seed); /**< Parameterized constructor */
+    SplitMix64(const SplitMix64&) = default; /**< Copy constructor */
+    ~SplitMix64(); /**< Destructor */
+
+    std::uint64_t next(); /**< Returns the next output */
+
+    static std::uint64_t at(std::uint64_t seed, std::uint64_t index); /**< Returns output index (from 0) of the sequence seeded with seed, without stepping through it */
+    static std::uint64_t mix(std::uint64_t); /**< Scrambles 64 bits (the output function) */
+
+    SplitMix64& operator=(const SplitMix64&) = default; /**< Copy assignment operator */
+
+// Private members.
+private:
+    std::uint64_t state_; /**< Counter, advanced by the golden gamma each step */
+
+};
+//
+//  Terminating Precompiler Directives  ////////////////////////////////////////
+//
+#endif // SPLIT_MIX_64_H_
+//
@@ -0,0 +1,360 @@
+/**
+ *
+ * @file Xoshiro256.cpp
+ *
+ * @brief xoshiro256** pseudo-random generator with jump-ahead
+ *
+ * @author Josh Wiley
+ *
+ * @details Implements the Xoshiro256 class (Blackman and Vigna). 256 bits of
+ *          state, period 2^256 - 1, a few shifts, rotates, and xors per
+ *          output, and jump polynomials that advance 2^128 or 2^192 steps,
+ *          so a parent generator can be split into streams that provably
+ *          do not overlap. Bounded integers use Lemire's multiply-shift with
+ *          rejection instead of a modulo, which is both faster and unbiased.
+ *
+ */
+//
+//  Preprocessor Directives  ///////////////////////////////////////////////////
+//
+#ifndef XOSHIRO_256_CPP_
+#define XOSHIRO_256_CPP_
+#define UNIT_SCALE (double) 1.1102230246251565e-16
+//
+//  Header Files  //////////////////////////////////////////////////////////////
+//
+#include "Xoshiro256.h"
+#include "SplitMix64.h"
+//
+//  Function Implementation  ///////////////////////////////////////////////////
+//
+/**
+ *
+ * @brief Rotates 64 bits left
+ *
+ * @param[in] x
+ *            Bits to rotate
+ *
+ * @param[in] k
+ *            Positions to rotate by (1..63)
+ *
+ * @return Rotated bits
+ *
+ */
+static inline std::uint64_t rotl(std::uint64_t x, int k)
+{
+    // Return.
+    return (x << k) | (x >> (64 - k));
+}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Expands the seed into the four state words with SplitMix64, as
+ *          the authors recommend (any seed, including 0, gives a usable
+ *          state)
+ *
+ * @param[in] seed
+ *            Seed
+ *
+ */
+Xoshiro256::Xoshiro256(std::uint64_t seed)
+{
+    // Expand.
+    auto expander = SplitMix64(seed);
+    for (auto& word : state_)
+    {
+        // Fill.
+        word = expander.next();
+    }
+}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Destructor
+ *
+ */
+Xoshiro256::~Xoshiro256() {}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Returns the scrambled second word and steps the state
+ *
+ * @return Next 64 random bits
+ *
+ */
+std::uint64_t Xoshiro256::next()
+{
+    // Output.
+    auto result = rotl(state_[1] * 5, 7) * 9;
+
+    // Step.
+    auto t = state_[1] << 17;
+    state_[2] ^= state_[0];
+    state_[3] ^= state_[1];
+    state_[1] ^= state_[2];
+    state_[0] ^= state_[3];
+    state_[2] ^= t;
+    state_[3] = rotl(state_[3], 45);
+
+    // Return.
+    return result;
+}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Returns the next 64 random bits, so the generator can drive the
+ *          standard distributions
+ *
+ * @return Next 64 random bits
+ *
+ */
+std::uint64_t Xoshiro256::operator()()
+{
+    // Return.
+    return next();
+}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Returns a uniform double in [0, 1)
+ *
+ * @return Uniform double
+ *
+ */
+double Xoshiro256::unit()
+{
+    // Return.
+    return unit_from(next());
+}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Returns a uniform integer in [min, max], redrawing the rare
+ *          outputs that would bias it
+ *
+ * @param[in] min
+ *            Smallest value
+ *
+ * @param[in] max
+ *            Largest value (at least min)
+ *
+ * @return Uniform integer
+ *
+ */
+unsigned int Xoshiro256::uniform(unsigned int min, unsigned int max)
+{
+    // Range.
+    auto range = (std::uint64_t) max - min + 1;
+    auto value = 0u;
+
+    // Draw until accepted.
+    while (!bounded_from(next(), range, value))
+    {
+        // Redraw.
+    }
+
+    // Return.
+    return min + value;
+}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Advances the generator 2^128 steps; calling it between
+ *          handing out copies gives 2^128 non-overlapping subsequences
+ *
+ */
+void Xoshiro256::jump()
+{
+    // Jump polynomial.
+    static const std::uint64_t polynomial[4] = {
+        0x180EC6D33CFD0ABAull, 0xD5A61266F0C9392Cull,
+        0xA9582618E03FC9AAull, 0x39ABDC4529B1661Cull
+    };
+
+    // Jump.
+    jump_by(polynomial);
+}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Advances the generator 2^192 steps (for splitting streams that
+ *          are themselves split with jump())
+ *
+ */
+void Xoshiro256::long_jump()
+{
+    // Jump polynomial.
+    static const std::uint64_t polynomial[4] = {
+        0x76E15D3EFEFDCBBFull, 0xC5004E441C522FB3ull,
+        0x77710069854EE241ull, 0x39109BB02ACBE635ull
+    };
+
+    // Jump.
+    jump_by(polynomial);
+}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Returns a copy at the current position and jumps this generator
+ *          2^128 steps, so the copy owns the next 2^128 outputs and repeated
+ *          splits hand out disjoint streams
+ *
+ * @return Generator for the split-off stream
+ *
+ */
+Xoshiro256 Xoshiro256::split()
+{
+    // Copy.
+    auto child = *this;
+
+    // Move past it.
+    jump();
+
+    // Return.
+    return child;
+}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Returns the four state words
+ *
+ * @return Pointer to the state words
+ *
+ */
+const std::uint64_t* Xoshiro256::state() const
+{
+    // Return.
+    return state_;
+}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Maps 64 random bits to [0, 1) using the top 53 bits, so every
+ *          result is a multiple of 2^-53
+ *
+ * @param[in] bits
+ *            Random bits
+ *
+ * @return Uniform double
+ *
+ */
+double Xoshiro256::unit_from(std::uint64_t bits)
+{
+    // Return.
+    return (bits >> 11) * UNIT_SCALE;
+}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Maps the top 32 of 64 random bits to [0, range) with Lemire's
+ *          multiply-shift; the few products that would over-represent some
+ *          values are rejected (a chance of range / 2^32 at most)
+ *
+ * @param[in] bits
+ *            Random bits
+ *
+ * @param[in] range
+ *            Number of values (1..2^32)
+ *
+ * @param[out] value
+ *             Assigned the value when accepted
+ *
+ * @return Boolean value indicating acceptance (false: draw new bits)
+ *
+ */
+bool Xoshiro256::bounded_from(std::uint64_t bits, std::uint64_t range, unsigned int& value)
+{
+    // Scale.
+    auto product = (bits >> 32) * range;
+    auto low = (std::uint32_t) product;
+
+    // Possibly biased?
+    if (low < range)
+    {
+        // 2^32 mod range.
+        auto threshold = (std::uint32_t) ((((std::uint64_t) 1) << 32) % range);
+        if (low < threshold)
+        {
+            // Reject.
+            return false;
+        }
+    }
+
+    // Accept.
+    value = (unsigned int) (product >> 32);
+    return true;
+}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Advances the state by a jump polynomial: xors together the
+ *          states at every step whose bit is set
+ *
+ * @param[in] polynomial
+ *            Jump polynomial, as four words
+ *
+ */
+void Xoshiro256::jump_by(const std::uint64_t* polynomial)
+{
+    // Accumulated state.
+    std::uint64_t jumped[4] = { 0, 0, 0, 0 };
+
+    // Each bit of the polynomial.
+    for (auto word = 0; word < 4; word++)
+    {
+        for (auto bit = 0; bit < 64; bit++)
+        {
+            // Set?
+            if (polynomial[word] & ((std::uint64_t) 1 << bit))
+            {
+                // Accumulate.
+                for (auto i = 0; i < 4; i++)
+                {
+                    // Xor.
+                    jumped[i] ^= state_[i];
+                }
+            }
+
+            // Step.
+            next();
+        }
+    }
+
+    // Take.
+    for (auto i = 0; i < 4; i++)
+    {
+        // Copy.
+        state_[i] = jumped[i];
+    }
+}
+//
+//  Terminating Precompiler Directives  ////////////////////////////////////////
+//
+#endif // XOSHIRO_256_CPP_
+//
@@ -0,0 +1,65 @@
+/**
+ *
+ * @file Xoshiro256.h
+ *
+ * @brief xoshiro256** pseudo-random generator with jump-ahead
+ *
+ * @author Josh Wiley
+ *
+ * @details Defines the Xoshiro256 class
+ *
+ */
+//
+//  Preprocessor Directives  ///////////////////////////////////////////////////
+//
+#ifndef XOSHIRO_256_H_
+#define XOSHIRO_256_H_
+//
+//  Header Files  //////////////////////////////////////////////////////////////
+//
+#include <cstdint>
+#include <limits>
+//
+//  Class Definition  //////////////////////////////////////////////////////////
+//
+class Xoshiro256
+{
+
+// Public members.
+public:
+    typedef std::uint64_t result_type; /**< Output type (UniformRandomBitGenerator) */
+
+    Xoshiro256(std::uint64_t seed); /**< Parameterized constructor (state expanded from the seed) */
+    Xoshiro256(const Xoshiro256&) = default; /**< Copy constructor (same stream, same position) */
+    ~Xoshiro256(); /**< Destructor */
+
+    std::uint64_t next(); /**< Returns the next 64 random bits */
+    std::uint64_t operator()(); /**< Returns the next 64 random bits (UniformRandomBitGenerator) */
+    double unit(); /**< Returns a uniform double in [0, 1) */
+    unsigned int uniform(unsigned int, unsigned int); /**< Returns a uniform integer in [min, max], without modulo bias */
+
+    void jump(); /**< Advances 2^128 steps (non-overlapping streams for up to 2^128 generators) */
+    void long_jump(); /**< Advances 2^192 steps */
+    Xoshiro256 split(); /**< Returns a generator at the current position and jumps this one past it */
+
+    const std::uint64_t* state() const; /**< Returns the four state words */
+
+    static constexpr std::uint64_t min() { return 0; } /**< Smallest output */
+    static constexpr std::uint64_t max() { return std::numeric_limits< std::uint64_t >::max(); } /**< Largest output */
+    static double unit_from(std::uint64_t); /**< Maps 64 random bits to a double in [0, 1) (top 53 bits) */
+    static bool bounded_from(std::uint64_t, std::uint64_t, unsigned int&); /**< Maps 64 random bits to [0, range) (range 1..2^32), returns false if the bits must be redrawn */
+
+    Xoshiro256& operator=(const Xoshiro256&) = default; /**< Copy assignment operator */
+
+// Private members.
+private:
+    void jump_by(const std::uint64_t*); /**< Advances by the jump polynomial given as four words */
+
+    std::uint64_t state_[4]; /**< State (never all zero) */
+
+};
+//
+//  Terminating Precompiler Directives  ////////////////////////////////////////
+//
+#endif // XOSHIRO_256_H_
+//
@@ -0,0 +1,394 @@
+/**
+ *
+ * @file Xoshiro256x4.cpp
+ *
+ * @brief Four interleaved xoshiro256** streams stepped together, for
+ *        filling buffers with SIMD
+ *
+ * @author Josh Wiley
+ *
+ * @details Implements the Xoshiro256x4 class. Lane l starts l jumps (l *
+ *          2^128 steps) past the parent generator, and the stream is lane
+ *          outputs interleaved: lane 0, 1, 2, 3 of step 0, then of step 1,
+ *          and so on. xoshiro256** only needs shifts, xors, and adds (the
+ *          multiplies by 5 and 9 are a shift and an add), so AVX2 steps all
+ *          four lanes in one register per state word and SSE2 in two; the
+ *          scalar path produces the same stream, so results do not depend
+ *          on the build.
+ *
+ */
+//
+//  Preprocessor Directives  ///////////////////////////////////////////////////
+//
+#ifndef XOSHIRO_256_X4_CPP_
+#define XOSHIRO_256_X4_CPP_
+#define MAP_BLOCK_LENGTH (size_t) 256
+//
+//  Header Files  //////////////////////////////////////////////////////////////
+//
+#include <algorithm>
+#include "Xoshiro256x4.h"
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+//
+//  Static Member Definitions  /////////////////////////////////////////////////
+//
+const size_t Xoshiro256x4::lane_count;
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Parameterized constructor
+ *
+ * @param[in] seed
+ *            Seed of the parent generator
+ *
+ */
+Xoshiro256x4::Xoshiro256x4(std::uint64_t seed) : Xoshiro256x4(Xoshiro256(seed)) {}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Splits a lane off the parent generator for each lane
+ *
+ * @param[in] parent
+ *            Generator whose next 4 * 2^128 outputs the lanes take over
+ *
+ */
+Xoshiro256x4::Xoshiro256x4(Xoshiro256 parent) : buffered_(0)
+{
+    // Each lane.
+    for (auto lane = (size_t) 0; lane < lane_count; lane++)
+    {
+        // Split.
+        auto stream = parent.split();
+        for (auto word = 0; word < 4; word++)
+        {
+            // Copy.
+            state_[word][lane] = stream.state()[word];
+        }
+    }
+}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Destructor
+ *
+ */
+Xoshiro256x4::~Xoshiro256x4() {}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Returns the next value of the interleaved stream, stepping every
+ *          lane once per four values
+ *
+ * @return Next 64 random bits
+ *
+ */
+std::uint64_t Xoshiro256x4::operator()()
+{
+    // Out of buffered values?
+    if (buffered_ == 0)
+    {
+        // Step, stored last lane first so values are taken from the end.
+        std::uint64_t block[lane_count];
+        step(block, 1);
+        std::reverse_copy(block, block + lane_count, buffer_);
+        buffered_ = lane_count;
+    }
+
+    // Return.
+    return buffer_[--buffered_];
+}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Fills a buffer with the next values of the interleaved stream:
+ *          buffered values first, whole steps written directly, and the tail
+ *          one value at a time
+ *
+ * @param[out] output
+ *             Buffer receiving count values
+ *
+ * @param[in] count
+ *             Number of values
+ *
+ */
+void Xoshiro256x4::fill(std::uint64_t* output, size_t count)
+{
+    // Buffered values.
+    while (count != 0 && buffered_ != 0)
+    {
+        // Take.
+        *output++ = buffer_[--buffered_];
+        count--;
+    }
+
+    // Whole steps.
+    auto blocks = count / lane_count;
+    step(output, blocks);
+    output += blocks * lane_count;
+    count -= blocks * lane_count;
+
+    // Tail.
+    while (count != 0)
+    {
+        // Take.
+        *output++ = (*this)();
+        count--;
+    }
+}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Fills a buffer with uniform doubles in [0, 1)
+ *
+ * @param[out] output
+ *             Buffer receiving count values
+ *
+ * @param[in] count
+ *             Number of values
+ *
+ */
+void Xoshiro256x4::fill_unit(double* output, size_t count)
+{
+    // Random bits.
+    std::uint64_t bits[MAP_BLOCK_LENGTH];
+
+    // Blocks.
+    for (auto done = (size_t) 0; done < count; )
+    {
+        // Draw.
+        auto length = std::min(MAP_BLOCK_LENGTH, count - done);
+        fill(bits, length);
+
+        // Map.
+        for (auto i = (size_t) 0; i < length; i++)
+        {
+            // Scale.
+            output[done + i] = Xoshiro256::unit_from(bits[i]);
+        }
+
+        // Advance.
+        done += length;
+    }
+}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Fills a buffer with uniform integers in [min, max], mapping
+ *          blocks of draws at a time; the rare rejected draws of a block are
+ *          replaced, in order, with values drawn after the block
+ *
+ * @param[out] output
+ *             Buffer receiving count values
+ *
+ * @param[in] count
+ *             Number of values
+ *
+ * @param[in] min
+ *            Smallest value
+ *
+ * @param[in] max
+ *            Largest value (at least min)
+ *
+ */
+void Xoshiro256x4::fill_uniform(unsigned int* output, size_t count, unsigned int min, unsigned int max)
+{
+    // Range, bias threshold (2^32 mod range), and random bits.
+    auto range = (std::uint64_t) max - min + 1;
+    auto threshold = (std::uint32_t) ((((std::uint64_t) 1) << 32) % range);
+    std::uint64_t bits[MAP_BLOCK_LENGTH];
+
+    // Blocks.
+    for (auto done = (size_t) 0; done < count; )
+    {
+        // Draw.
+        auto length = std::min(MAP_BLOCK_LENGTH, count - done);
+        fill(bits, length);
+
+        // Map without branches (vectorizable), noting any biased product.
+        auto rejected = false;
+        for (auto i = (size_t) 0; i < length; i++)
+        {
+            // Multiply-shift.
+            auto product = (bits[i] >> 32) * range;
+            output[done + i] = min + (unsigned int) (product >> 32);
+            rejected |= (std::uint32_t) product < threshold;
+        }
+
+        // Rare: redraw rejected values, in order, from the rest of the stream.
+        for (auto i = (size_t) 0; rejected && i < length; i++)
+        {
+            // Redraw until accepted.
+            auto value = 0u;
+            if (!Xoshiro256::bounded_from(bits[i], range, value))
+            {
+                // Next values of the stream.
+                while (!Xoshiro256::bounded_from((*this)(), range, value))
+                {
+                    // Redraw.
+                }
+                output[done + i] = min + value;
+            }
+        }
+
+        // Advance.
+        done += length;
+    }
+}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Returns name of the vector instruction set in use
+ *
+ * @return "AVX2", "SSE2", or "scalar"
+ *
+ */
+const char* Xoshiro256x4::instruction_set()
+{
+#if defined(__AVX2__)
+    // Return.
+    return "AVX2";
+#elif defined(__SSE2__)
+    // Return.
+    return "SSE2";
+#else
+    // Return.
+    return "scalar";
+#endif
+}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Steps every lane blocks times, writing each step's four outputs
+ *          in lane order
+ *
+ * @param[out] output
+ *             Buffer receiving 4 * blocks values
+ *
+ * @param[in] blocks
+ *            Number of steps
+ *
+ */
+void Xoshiro256x4::step(std::uint64_t* output, size_t blocks)
+{
+#if defined(__AVX2__)
+    // Load state words.
+    auto s0 = _mm256_load_si256((const __m256i*) state_[0]);
+    auto s1 = _mm256_load_si256((const __m256i*) state_[1]);
+    auto s2 = _mm256_load_si256((const __m256i*) state_[2]);
+    auto s3 = _mm256_load_si256((const __m256i*) state_[3]);
+
+    // Steps.
+    for (auto block = (size_t) 0; block < blocks; block++)
+    {
+        // Output: rotl(s1 * 5, 7) * 9.
+        auto times5 = _mm256_add_epi64(_mm256_slli_epi64(s1, 2), s1);
+        auto rotated = _mm256_or_si256(_mm256_slli_epi64(times5, 7), _mm256_srli_epi64(times5, 57));
+        auto result = _mm256_add_epi64(_mm256_slli_epi64(rotated, 3), rotated);
+        _mm256_storeu_si256((__m256i*) (output + block * lane_count), result);
+
+        // Step.
+        auto t = _mm256_slli_epi64(s1, 17);
+        s2 = _mm256_xor_si256(s2, s0);
+        s3 = _mm256_xor_si256(s3, s1);
+        s1 = _mm256_xor_si256(s1, s2);
+        s0 = _mm256_xor_si256(s0, s3);
+        s2 = _mm256_xor_si256(s2, t);
+        s3 = _mm256_or_si256(_mm256_slli_epi64(s3, 45), _mm256_srli_epi64(s3, 19));
+    }
+
+    // Store state words.
+    _mm256_store_si256((__m256i*) state_[0], s0);
+    _mm256_store_si256((__m256i*) state_[1], s1);
+    _mm256_store_si256((__m256i*) state_[2], s2);
+    _mm256_store_si256((__m256i*) state_[3], s3);
+#elif defined(__SSE2__)
+    // Load state words (lanes 0-1 and 2-3).
+    __m128i s[4][2];
+    for (auto word = 0; word < 4; word++)
+    {
+        // Load.
+        s[word][0] = _mm_load_si128((const __m128i*) state_[word]);
+        s[word][1] = _mm_load_si128((const __m128i*) (state_[word] + 2));
+    }
+
+    // Steps.
+    for (auto block = (size_t) 0; block < blocks; block++)
+    {
+        // Each half.
+        for (auto half = 0; half < 2; half++)
+        {
+            // Output: rotl(s1 * 5, 7) * 9.
+            auto times5 = _mm_add_epi64(_mm_slli_epi64(s[1][half], 2), s[1][half]);
+            auto rotated = _mm_or_si128(_mm_slli_epi64(times5, 7), _mm_srli_epi64(times5, 57));
+            auto result = _mm_add_epi64(_mm_slli_epi64(rotated, 3), rotated);
+            _mm_storeu_si128((__m128i*) (output + block * lane_count + 2 * half), result);
+
+            // Step.
+            auto t = _mm_slli_epi64(s[1][half], 17);
+            s[2][half] = _mm_xor_si128(s[2][half], s[0][half]);
+            s[3][half] = _mm_xor_si128(s[3][half], s[1][half]);
+            s[1][half] = _mm_xor_si128(s[1][half], s[2][half]);
+            s[0][half] = _mm_xor_si128(s[0][half], s[3][half]);
+            s[2][half] = _mm_xor_si128(s[2][half], t);
+            s[3][half] = _mm_or_si128(_mm_slli_epi64(s[3][half], 45), _mm_srli_epi64(s[3][half], 19));
+        }
+    }
+
+    // Store state words.
+    for (auto word = 0; word < 4; word++)
+    {
+        // Store.
+        _mm_store_si128((__m128i*) state_[word], s[word][0]);
+        _mm_store_si128((__m128i*) (state_[word] + 2), s[word][1]);
+    }
+#else
+    // Steps.
+    for (auto block = (size_t) 0; block < blocks; block++)
+    {
+        // Each lane.
+        for (auto lane = (size_t) 0; lane < lane_count; lane++)
+        {
+            // Output: rotl(s1 * 5, 7) * 9.
+            auto times5 = state_[1][lane] * 5;
+            auto rotated = (times5 << 7) | (times5 >> 57);
+            output[block * lane_count + lane] = rotated * 9;
+
+            // Step.
+            auto t = state_[1][lane] << 17;
+            state_[2][lane] ^= state_[0][lane];
+            state_[3][lane] ^= state_[1][lane];
+            state_[1][lane] ^= state_[2][lane];
+            state_[0][lane] ^= state_[3][lane];
+            state_[2][lane] ^= t;
+            state_[3][lane] = (state_[3][lane] << 45) | (state_[3][lane] >> 19);
+        }
+    }
+#endif
+}
+//
+//  Terminating Precompiler Directives  ////////////////////////////////////////
+//
+#endif // XOSHIRO_256_X4_CPP_
+//
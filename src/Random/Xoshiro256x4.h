@@ -0,0 +1,66 @@
+/**
+ *
+ * @file Xoshiro256x4.h
+ *
+ * @brief Four interleaved xoshiro256** streams stepped together, for
+ *        filling buffers with SIMD
+ *
+ * @author Josh Wiley
+ *
+ * @details Defines the Xoshiro256x4 class
+ *
+ */
+//
+//  Preprocessor Directives  ///////////////////////////////////////////////////
+//
+#ifndef XOSHIRO_256_X4_H_
+#define XOSHIRO_256_X4_H_
+//
+//  Header Files  //////////////////////////////////////////////////////////////
+//
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include "Xoshiro256.h"
+//
+//  Class Definition  //////////////////////////////////////////////////////////
+//
+class Xoshiro256x4
+{
+
+// Public members.
+public:
+    typedef std::uint64_t result_type; /**< Output type (UniformRandomBitGenerator) */
+
+    Xoshiro256x4(std::uint64_t seed); /**< Parameterized constructor (lanes split from Xoshiro256(seed)) */
+    Xoshiro256x4(Xoshiro256); /**< Parameterized constructor (lanes split from a generator) */
+    Xoshiro256x4(const Xoshiro256x4&) = default; /**< Copy constructor (same streams, same position) */
+    ~Xoshiro256x4(); /**< Destructor */
+
+    std::uint64_t operator()(); /**< Returns the next 64 random bits of the interleaved stream */
+    void fill(std::uint64_t*, size_t); /**< Fills a buffer with the next random bits of the interleaved stream */
+    void fill_unit(double*, size_t); /**< Fills a buffer with uniform doubles in [0, 1) */
+    void fill_uniform(unsigned int*, size_t, unsigned int, unsigned int); /**< Fills a buffer with uniform integers in [min, max], without modulo bias */
+
+    static const char* instruction_set(); /**< Returns name of the vector instruction set the bulk step was built for */
+    static constexpr std::uint64_t min() { return 0; } /**< Smallest output */
+    static constexpr std::uint64_t max() { return std::numeric_limits< std::uint64_t >::max(); } /**< Largest output */
+
+    Xoshiro256x4& operator=(const Xoshiro256x4&) = default; /**< Copy assignment operator */
+
+// Private members.
+private:
+    static const size_t lane_count = 4; /**< Number of interleaved streams */
+
+    void step(std::uint64_t*, size_t); /**< Writes blocks of one output per lane (4 values per block), stepping every lane once per block */
+
+    alignas(32) std::uint64_t state_[4][lane_count]; /**< State word w of lane l at [w][l], so each word of all lanes is one vector */
+    std::uint64_t buffer_[lane_count]; /**< Outputs of the last single step not yet handed out */
+    size_t buffered_; /**< Number of outputs left in buffer_ (taken from its end) */
+
+};
+//
+//  Terminating Precompiler Directives  ////////////////////////////////////////
+//
+#endif // XOSHIRO_256_X4_H_
+//
@@ -0,0 +1,154 @@
+/**
+ *
+ * @file ReplicationRunner.cpp
+ *
+ * @brief Runs independent replications of a scenario on a thread pool
+ *
+ * @author Josh Wiley
+ *
+ * @details Implements the ReplicationRunner class. Replication i draws every
+ *          random number from a stream seeded by stream_seed(i), a function
+ *          of the base seed and i alone, and its report lands in slot i;
+ *          the reports are merged in slot order once all have finished. So
+ *          a run depends only on the base seed and the number of
+ *          replications, never on the number of threads or the order the
+ *          pool happened to run them in.
+ *
+ */
+//
+//  Preprocessor Directives  ///////////////////////////////////////////////////
+//
+#ifndef REPLICATION_RUNNER_CPP_
+#define REPLICATION_RUNNER_CPP_
+//
+//  Header Files  //////////////////////////////////////////////////////////////
+//
+#include <vector>
+#include "ReplicationRunner.h"
+#include "../Random/SplitMix64.h"
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Parameterized constructor
+ *
+ * @param[in] pool
+ *            Threads replications run on
+ *
+ * @param[in] base_seed
+ *            Seed every replication's stream is derived from
+ *
+ */
+ReplicationRunner::ReplicationRunner(std::shared_ptr< ThreadPool > pool, std::uint64_t base_seed)
+    : pool_(pool), base_seed_(base_seed) {}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Destructor
+ *
+ */
+ReplicationRunner::~ReplicationRunner() {}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Runs each replication on the pool with its own stream seed, keeps
+ *          its report in its own slot, and folds the reports into the
+ *          summary in replication order
+ *
+ * @param[in] scenario
+ *            Builds and runs one replication from its stream seed (called
+ *            concurrently, so it must not share mutable state)
+ *
+ * @param[in] replications
+ *            Number of replications
+ *
+ * @return Merged results
+ *
+ */
+ReplicationSummary ReplicationRunner::run(const Scenario& scenario, size_t replications) const
+{
+    // Slot per replication.
+    auto reports = std::vector< std::unique_ptr< SimulationReport > >(replications);
+
+    // Run.
+    pool_->parallel_for(replications, [&] (size_t replication) {
+        reports[replication].reset(new SimulationReport(scenario(stream_seed(replication))));
+    });
+
+    // Merge in order.
+    auto summary = ReplicationSummary();
+    for (auto& report : reports)
+    {
+        // Fold.
+        summary.add(*report);
+    }
+
+    // Return.
+    return summary;
+}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Returns seed every replication's stream is derived from
+ *
+ * @return Base seed
+ *
+ */
+std::uint64_t ReplicationRunner::base_seed() const
+{
+    // Return.
+    return base_seed_;
+}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Returns seed of a replication's random stream
+ *
+ * @param[in] replication
+ *            Index of the replication
+ *
+ * @return Seed of the replication's stream
+ *
+ */
+std::uint64_t ReplicationRunner::stream_seed(size_t replication) const
+{
+    // Return.
+    return stream_seed(base_seed_, replication);
+}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Returns seed of stream i: output i of the SplitMix64 sequence
+ *          seeded with the base seed, which scatters consecutive streams
+ *          across the whole seed space
+ *
+ * @param[in] base_seed
+ *            Seed every stream is derived from
+ *
+ * @param[in] stream
+ *            Index of the stream
+ *
+ * @return Seed of the stream
+ *
+ */
+std::uint64_t ReplicationRunner::stream_seed(std::uint64_t base_seed, size_t stream)
+{
+    // Return.
+    return SplitMix64::at(base_seed, stream);
+}
+//
+//  Terminating Precompiler Directives  ////////////////////////////////////////
+//
+#endif // REPLICATION_RUNNER_CPP_
+//
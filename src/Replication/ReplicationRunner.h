@@ -0,0 +1,58 @@
+/**
+ *
+ * @file ReplicationRunner.h
+ *
+ * @brief Runs independent replications of a scenario on a thread pool
+ *
+ * @author Josh Wiley
+ *
+ * @details Defines the ReplicationRunner class
+ *
+ */
+//
+//  Preprocessor Directives  ///////////////////////////////////////////////////
+//
+#ifndef REPLICATION_RUNNER_H_
+#define REPLICATION_RUNNER_H_
+//
+//  Header Files  //////////////////////////////////////////////////////////////
+//
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <functional>
+#include "../ThreadPool/ThreadPool.h"
+#include "../ServiceQueueSimulation/SimulationReport.h"
+#include "ReplicationSummary.h"
+//
+//  Class Definition  //////////////////////////////////////////////////////////
+//
+class ReplicationRunner
+{
+
+// Public members.
+public:
+    typedef std::function< SimulationReport(std::uint64_t) > Scenario; /**< Builds and runs one replication from the seed of its random stream */
+
+    ReplicationRunner(std::shared_ptr< ThreadPool >, std::uint64_t base_seed); /**< Parameterized constructor */
+    ReplicationRunner(const ReplicationRunner&) = default; /**< Copy constructor */
+    ~ReplicationRunner(); /**< Destructor */
+
+    ReplicationSummary run(const Scenario&, size_t) const; /**< Runs replications 0..n-1 of a scenario in parallel and merges their reports in order */
+
+    std::uint64_t base_seed() const; /**< Seed every replication's stream is derived from */
+    std::uint64_t stream_seed(size_t) const; /**< Seed of one replication's random stream */
+
+    static std::uint64_t stream_seed(std::uint64_t, size_t); /**< Seed of stream i derived from a base seed */
+
+// Private members.
+private:
+    std::shared_ptr< ThreadPool > pool_; /**< Threads replications run on */
+    std::uint64_t base_seed_; /**< Seed every stream is derived from */
+
+};
+//
+//  Terminating Precompiler Directives  ////////////////////////////////////////
+//
+#endif // REPLICATION_RUNNER_H_
+//
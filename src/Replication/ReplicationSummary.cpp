@@ -0,0 +1,280 @@
+/**
+ *
+ * @file ReplicationSummary.cpp
+ *
+ * @brief Results of independent replications of a scenario, merged into
+ *        means and confidence intervals
+ *
+ * @author Josh Wiley
+ *
+ * @details Implements the ReplicationSummary class. Each replication
+ *          contributes one observation of every output (the replication /
+ *          deletion method), so the outputs' confidence intervals come from
+ *          independent samples even though the customers within one run are
+ *          correlated. Customer statistics are also pooled across runs.
+ *
+ */
+//
+//  Preprocessor Directives  ///////////////////////////////////////////////////
+//
+#ifndef REPLICATION_SUMMARY_CPP_
+#define REPLICATION_SUMMARY_CPP_
+//
+//  Header Files  //////////////////////////////////////////////////////////////
+//
+#include "ReplicationSummary.h"
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Default constructor (no replications)
+ *
+ */
+ReplicationSummary::ReplicationSummary() {}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Destructor
+ *
+ */
+ReplicationSummary::~ReplicationSummary() {}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Folds one replication's report into the summary; reports must be
+ *          added in replication order for results that do not depend on how
+ *          the replications were scheduled
+ *
+ * @param[in] report
+ *            Report of one replication
+ *
+ */
+void ReplicationSummary::add(const SimulationReport& report)
+{
+    // Waits.
+    average_wait_.add(report.waits().mean());
+    max_wait_.add(report.waits().max());
+    wait_p90_.add(report.wait_percentiles().p90);
+    wait_p99_.add(report.wait_percentiles().p99);
+
+    // Times in system.
+    average_sojourn_.add(report.sojourns().mean());
+    sojourn_p99_.add(report.sojourn_percentiles().p99);
+
+    // Lines.
+    average_line_length_.add(report.average_line_length());
+    max_line_length_.add(report.max_line_length());
+    average_customers_waiting_.add(report.average_customers_waiting());
+
+    // Duration.
+    sim_time_.add(report.sim_time());
+
+    // Pooled.
+    pooled_waits_.merge(report.waits());
+    pooled_sojourns_.merge(report.sojourns());
+}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Returns number of replications folded in
+ *
+ * @return Number of replications
+ *
+ */
+size_t ReplicationSummary::replication_count() const
+{
+    // Return.
+    return (size_t) average_wait_.count();
+}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Returns average wait time, one observation per replication
+ *
+ * @return Summary across replications
+ *
+ */
+const RunningStatistics& ReplicationSummary::average_wait() const
+{
+    // Return.
+    return average_wait_;
+}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Returns maximum wait time, one observation per replication
+ *
+ * @return Summary across replications
+ *
+ */
+const RunningStatistics& ReplicationSummary::max_wait() const
+{
+    // Return.
+    return max_wait_;
+}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Returns 90th percentile wait time, one observation per replication
+ *
+ * @return Summary across replications
+ *
+ */
+const RunningStatistics& ReplicationSummary::wait_p90() const
+{
+    // Return.
+    return wait_p90_;
+}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Returns 99th percentile wait time, one observation per replication
+ *
+ * @return Summary across replications
+ *
+ */
+const RunningStatistics& ReplicationSummary::wait_p99() const
+{
+    // Return.
+    return wait_p99_;
+}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Returns average time in system, one observation per replication
+ *
+ * @return Summary across replications
+ *
+ */
+const RunningStatistics& ReplicationSummary::average_sojourn() const
+{
+    // Return.
+    return average_sojourn_;
+}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Returns 99th percentile time in system, one observation per replication
+ *
+ * @return Summary across replications
+ *
+ */
+const RunningStatistics& ReplicationSummary::sojourn_p99() const
+{
+    // Return.
+    return sojourn_p99_;
+}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Returns time-averaged line length, one observation per replication
+ *
+ * @return Summary across replications
+ *
+ */
+const RunningStatistics& ReplicationSummary::average_line_length() const
+{
+    // Return.
+    return average_line_length_;
+}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Returns maximum line length, one observation per replication
+ *
+ * @return Summary across replications
+ *
+ */
+const RunningStatistics& ReplicationSummary::max_line_length() const
+{
+    // Return.
+    return max_line_length_;
+}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Returns time-averaged number of customers waiting, one observation per replication
+ *
+ * @return Summary across replications
+ *
+ */
+const RunningStatistics& ReplicationSummary::average_customers_waiting() const
+{
+    // Return.
+    return average_customers_waiting_;
+}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Returns simulation time covered, one observation per replication
+ *
+ * @return Summary across replications
+ *
+ */
+const RunningStatistics& ReplicationSummary::sim_time() const
+{
+    // Return.
+    return sim_time_;
+}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Returns wait times of every customer of every replication
+ *
+ * @return Summary of every wait
+ *
+ */
+const RunningStatistics& ReplicationSummary::pooled_waits() const
+{
+    // Return.
+    return pooled_waits_;
+}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Returns times in system of every customer of every replication
+ *
+ * @return Summary of every time in system
+ *
+ */
+const RunningStatistics& ReplicationSummary::pooled_sojourns() const
+{
+    // Return.
+    return pooled_sojourns_;
+}
+//
+//  Terminating Precompiler Directives  ////////////////////////////////////////
+//
+#endif // REPLICATION_SUMMARY_CPP_
+//
@@ -0,0 +1,74 @@
+/**
+ *
+ * @file ReplicationSummary.h
+ *
+ * @brief Results of independent replications of a scenario, merged into
+ *        means and confidence intervals
+ *
+ * @author Josh Wiley
+ *
+ * @details Defines the ReplicationSummary class
+ *
+ */
+//
+//  Preprocessor Directives  ///////////////////////////////////////////////////
+//
+#ifndef REPLICATION_SUMMARY_H_
+#define REPLICATION_SUMMARY_H_
+//
+//  Header Files  //////////////////////////////////////////////////////////////
+//
+#include <cstddef>
+#include "../Statistics/RunningStatistics.h"
+#include "../ServiceQueueSimulation/SimulationReport.h"
+//
+//  Class Definition  //////////////////////////////////////////////////////////
+//
+class ReplicationSummary
+{
+
+// Public members.
+public:
+    ReplicationSummary(); /**< Default constructor (no replications) */
+    ReplicationSummary(const ReplicationSummary&) = default; /**< Copy constructor */
+    ~ReplicationSummary(); /**< Destructor */
+
+    void add(const SimulationReport&); /**< Folds one replication's report into the summary */
+
+    size_t replication_count() const; /**< Number of replications folded in */
+    const RunningStatistics& average_wait() const; /**< Average wait time, one observation per replication */
+    const RunningStatistics& max_wait() const; /**< Maximum wait time, one observation per replication */
+    const RunningStatistics& wait_p90() const; /**< 90th percentile wait time, one observation per replication */
+    const RunningStatistics& wait_p99() const; /**< 99th percentile wait time, one observation per replication */
+    const RunningStatistics& average_sojourn() const; /**< Average time in system, one observation per replication */
+    const RunningStatistics& sojourn_p99() const; /**< 99th percentile time in system, one observation per replication */
+    const RunningStatistics& average_line_length() const; /**< Time-averaged line length, one observation per replication */
+    const RunningStatistics& max_line_length() const; /**< Maximum line length, one observation per replication */
+    const RunningStatistics& average_customers_waiting() const; /**< Time-averaged number waiting, one observation per replication */
+    const RunningStatistics& sim_time() const; /**< Simulation time covered, one observation per replication */
+    const RunningStatistics& pooled_waits() const; /**< Wait times of every customer of every replication */
+    const RunningStatistics& pooled_sojourns() const; /**< Times in system of every customer of every replication */
+
+    ReplicationSummary& operator=(const ReplicationSummary&) = default; /**< Copy assignment operator */
+
+// Private members.
+private:
+    RunningStatistics average_wait_; /**< Per-replication average wait */
+    RunningStatistics max_wait_; /**< Per-replication maximum wait */
+    RunningStatistics wait_p90_; /**< Per-replication 90th percentile wait */
+    RunningStatistics wait_p99_; /**< Per-replication 99th percentile wait */
+    RunningStatistics average_sojourn_; /**< Per-replication average time in system */
+    RunningStatistics sojourn_p99_; /**< Per-replication 99th percentile time in system */
+    RunningStatistics average_line_length_; /**< Per-replication average line length */
+    RunningStatistics max_line_length_; /**< Per-replication maximum line length */
+    RunningStatistics average_customers_waiting_; /**< Per-replication average number waiting */
+    RunningStatistics sim_time_; /**< Per-replication simulation time */
+    RunningStatistics pooled_waits_; /**< Every customer's wait */
+    RunningStatistics pooled_sojourns_; /**< Every customer's time in system */
+
+};
+//
+//  Terminating Precompiler Directives  ////////////////////////////////////////
+//
+#endif // REPLICATION_SUMMARY_H_
+//
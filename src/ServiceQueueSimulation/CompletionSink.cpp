@@ -0,0 +1,279 @@
+/**
+ *
+ * @file CompletionSink.cpp
+ *
+ * @brief Running statistics of customers whose service has been scheduled
+ *
+ * @author Josh Wiley
+ *
+ * @details Implements the CompletionSink class. A customer's departure is
+ *          known as soon as its service starts, so the servicer records it
+ *          then and the customer's row can be reused right away; the sink
+ *          keeps running summaries instead of the rows themselves.
+ *
+ */
+//
+//  Preprocessor Directives  ///////////////////////////////////////////////////
+//
+#ifndef COMPLETION_SINK_CPP_
+#define COMPLETION_SINK_CPP_
+//
+//  Header Files  //////////////////////////////////////////////////////////////
+//
+#include "CompletionSink.h"
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Default constructor
+ *
+ */
+CompletionSink::CompletionSink() {}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Creates a sink from summaries and histograms built elsewhere,
+ *          such as by the column kernels over a retained trace
+ *
+ * @param[in] waits
+ *            Summary of wait times
+ *
+ * @param[in] sojourns
+ *            Summary of sojourn times
+ *
+ * @param[in] wait_histogram
+ *            Histogram of wait times
+ *
+ * @param[in] sojourn_histogram
+ *            Histogram of sojourn times
+ *
+ */
+CompletionSink::CompletionSink(
+    const RunningStatistics& waits,
+    const RunningStatistics& sojourns,
+    const HdrHistogram& wait_histogram,
+    const HdrHistogram& sojourn_histogram
+)
+    : waits_(waits), sojourns_(sojourns),
+      wait_histogram_(wait_histogram), sojourn_histogram_(sojourn_histogram) {}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Copy-initializes sink from another sink
+ *
+ * @param[in] origin
+ *            Origin object from which the new object is to be instantiated with
+ *
+ */
+CompletionSink::CompletionSink(const CompletionSink& origin)
+    : waits_(origin.waits_), sojourns_(origin.sojourns_),
+      wait_histogram_(origin.wait_histogram_), sojourn_histogram_(origin.sojourn_histogram_) {}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Destructor
+ *
+ */
+CompletionSink::~CompletionSink() {}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Adds a customer's wait (arrival to service start) and sojourn
+ *          (arrival to departure) to the running summaries and histograms
+ *
+ * @param[in] arrival_time
+ *            The time at which the customer arrived
+ *
+ * @param[in] start_time
+ *            The time at which the customer's transaction started
+ *
+ * @param[in] departure_time
+ *            The time at which the customer's transaction ends
+ *
+ */
+void CompletionSink::record(unsigned int arrival_time, unsigned int start_time, unsigned int departure_time)
+{
+    // Wait and sojourn.
+    auto wait = start_time - arrival_time;
+    auto sojourn = departure_time - arrival_time;
+
+    // Wait.
+    waits_.add(wait);
+    wait_histogram_.record(wait);
+
+    // Sojourn.
+    sojourns_.add(sojourn);
+    sojourn_histogram_.record(sojourn);
+}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Folds another sink's summaries and histograms into this one, as
+ *          if its customers had been recorded here (for combining lanes,
+ *          replications, or threads)
+ *
+ * @param[in] other
+ *            Sink to fold in
+ *
+ */
+void CompletionSink::merge(const CompletionSink& other)
+{
+    // Summaries.
+    waits_.merge(other.waits_);
+    sojourns_.merge(other.sojourns_);
+
+    // Histograms.
+    wait_histogram_.merge(other.wait_histogram_);
+    sojourn_histogram_.merge(other.sojourn_histogram_);
+}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Returns number of customers recorded
+ *
+ * @return Number of customers recorded
+ *
+ */
+std::uint64_t CompletionSink::count() const
+{
+    // Return count.
+    return waits_.count();
+}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Returns mean wait time
+ *
+ * @return Mean time from arrival to service start (0 if nothing recorded)
+ *
+ */
+double CompletionSink::average_wait() const
+{
+    // Return mean.
+    return waits_.mean();
+}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Returns longest wait time
+ *
+ * @return Longest time from arrival to service start
+ *
+ */
+unsigned int CompletionSink::max_wait() const
+{
+    // Return max.
+    return (unsigned int) waits_.max();
+}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Returns mean sojourn time
+ *
+ * @return Mean time from arrival to departure (0 if nothing recorded)
+ *
+ */
+double CompletionSink::average_sojourn() const
+{
+    // Return mean.
+    return sojourns_.mean();
+}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Returns longest sojourn time
+ *
+ * @return Longest time from arrival to departure
+ *
+ */
+unsigned int CompletionSink::max_sojourn() const
+{
+    // Return max.
+    return (unsigned int) sojourns_.max();
+}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Returns summary of wait times (count, extrema, mean, variance)
+ *
+ * @return Summary of wait times
+ *
+ */
+const RunningStatistics& CompletionSink::waits() const
+{
+    // Return summary.
+    return waits_;
+}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Returns summary of sojourn times (count, extrema, mean, variance)
+ *
+ * @return Summary of sojourn times
+ *
+ */
+const RunningStatistics& CompletionSink::sojourns() const
+{
+    // Return summary.
+    return sojourns_;
+}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Returns histogram of wait times
+ *
+ * @return Histogram of wait times
+ *
+ */
+const HdrHistogram& CompletionSink::wait_histogram() const
+{
+    // Return histogram.
+    return wait_histogram_;
+}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Returns histogram of sojourn times
+ *
+ * @return Histogram of sojourn times
+ *
+ */
+const HdrHistogram& CompletionSink::sojourn_histogram() const
+{
+    // Return histogram.
+    return sojourn_histogram_;
+}
+//
+//  Terminating Precompiler Directives  ////////////////////////////////////////
+//
+#endif // COMPLETION_SINK_CPP_
+//
@@ -0,0 +1,66 @@
+/**
+ *
+ * @file CompletionSink.h
+ *
+ * @brief Running statistics of customers whose service has been scheduled
+ *
+ * @author Josh Wiley
+ *
+ * @details Defines the CompletionSink class
+ *
+ */
+//
+//  Preprocessor Directives  ///////////////////////////////////////////////////
+//
+#ifndef COMPLETION_SINK_H_
+#define COMPLETION_SINK_H_
+//
+//  Header Files  //////////////////////////////////////////////////////////////
+//
+#include <cstdint>
+#include "../Statistics/RunningStatistics.h"
+#include "../Statistics/HdrHistogram.h"
+//
+//  Class Definition  //////////////////////////////////////////////////////////
+//
+class CompletionSink
+{
+
+// Public members.
+public:
+    CompletionSink(); /**< Default constructor */
+    CompletionSink(
+        const RunningStatistics& waits,
+        const RunningStatistics& sojourns,
+        const HdrHistogram& wait_histogram,
+        const HdrHistogram& sojourn_histogram
+    ); /**< Parameterized constructor (from summaries built elsewhere) */
+    CompletionSink(const CompletionSink&); /**< Copy constructor */
+    ~CompletionSink(); /**< Destructor */
+
+    void record(unsigned int, unsigned int, unsigned int); /**< Folds a customer's arrival, service start, and departure times into the statistics */
+    void merge(const CompletionSink&); /**< Folds another sink's customers into this one */
+
+    std::uint64_t count() const; /**< Returns number of customers recorded */
+    double average_wait() const; /**< Returns mean time from arrival to service start */
+    unsigned int max_wait() const; /**< Returns longest time from arrival to service start */
+    double average_sojourn() const; /**< Returns mean time from arrival to departure */
+    unsigned int max_sojourn() const; /**< Returns longest time from arrival to departure */
+    const RunningStatistics& waits() const; /**< Returns summary of wait times */
+    const RunningStatistics& sojourns() const; /**< Returns summary of sojourn times */
+    const HdrHistogram& wait_histogram() const; /**< Returns histogram of wait times */
+    const HdrHistogram& sojourn_histogram() const; /**< Returns histogram of sojourn times */
+
+// Private members.
+private:
+    RunningStatistics waits_; /**< Summary of wait times */
+    RunningStatistics sojourns_; /**< Summary of sojourn times */
+    HdrHistogram wait_histogram_; /**< Histogram of wait times, for percentiles */
+    HdrHistogram sojourn_histogram_; /**< Histogram of sojourn times, for percentiles */
+
+};
+//
+//  Terminating Precompiler Directives  ////////////////////////////////////////
+//
+#endif // COMPLETION_SINK_H_
+//
@@ -0,0 +1,305 @@
+/**
+ *
+ * @file CustomerTable.cpp
+ *
+ * @brief Column-oriented store of simulated customers
+ *
+ * @author Josh Wiley
+ *
+ * @details Implements the CustomerTable class
+ *
+ */
+//
+//  Preprocessor Directives  ///////////////////////////////////////////////////
+//
+#ifndef CUSTOMER_TABLE_CPP_
+#define CUSTOMER_TABLE_CPP_
+//
+//  Header Files  //////////////////////////////////////////////////////////////
+//
+#include "CustomerTable.h"
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Reserves space in each column
+ *
+ * @param[in] capacity
+ *            Number of customers expected
+ *
+ * @param[in] arena_ptr
+ *            Arena to allocate from, or null to use the global heap
+ *
+ */
+CustomerTable::CustomerTable(size_t capacity, std::shared_ptr< Arena > arena_ptr)
+    : arrival_times_(ArenaAllocator< unsigned int >(arena_ptr)),
+      transaction_lengths_(ArenaAllocator< unsigned int >(arena_ptr)),
+      departure_times_(ArenaAllocator< unsigned int >(arena_ptr)),
+      free_ids_(ArenaAllocator< CustomerId >(arena_ptr))
+{
+    // Reserve columns.
+    arrival_times_.reserve(capacity);
+    transaction_lengths_.reserve(capacity);
+    departure_times_.reserve(capacity);
+}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Copy-initializes table from another table
+ *
+ * @param[in] origin
+ *            Origin object from which the new object is to be instantiated with
+ *
+ */
+CustomerTable::CustomerTable(const CustomerTable& origin)
+    : arrival_times_(origin.arrival_times_),
+      transaction_lengths_(origin.transaction_lengths_),
+      departure_times_(origin.departure_times_),
+      free_ids_(origin.free_ids_) {}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Destructor
+ *
+ */
+CustomerTable::~CustomerTable() {}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Adds a customer that has not departed yet, reusing the most
+ *          recently released row if there is one
+ *
+ * @param[in] arrival_time
+ *            The time at which the customer is available for service
+ *
+ * @param[in] transaction_length
+ *            The time which the customer's transaction will take
+ *
+ * @return Id of the new customer
+ *
+ */
+CustomerId CustomerTable::add(unsigned int arrival_time, unsigned int transaction_length)
+{
+    // Released row?
+    if (!free_ids_.empty())
+    {
+        // Take row.
+        auto id = free_ids_.back();
+        free_ids_.pop_back();
+
+        // Overwrite row.
+        arrival_times_[id] = arrival_time;
+        transaction_lengths_[id] = transaction_length;
+        departure_times_[id] = 0;
+
+        // Return id.
+        return id;
+    }
+
+    // Append row.
+    arrival_times_.push_back(arrival_time);
+    transaction_lengths_.push_back(transaction_length);
+    departure_times_.push_back(0);
+
+    // Return id.
+    return static_cast< CustomerId >(arrival_times_.size() - 1);
+}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Frees a customer's row; the id must not be used again until add
+ *          hands it out for a new customer
+ *
+ * @param[in] id
+ *            Customer whose row is no longer needed
+ *
+ */
+void CustomerTable::release(CustomerId id)
+{
+    // Remember row.
+    free_ids_.push_back(id);
+}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Returns number of customers in the table
+ *
+ * @return Number of customers in the table (rows not released)
+ *
+ */
+size_t CustomerTable::size() const
+{
+    // Return size.
+    return arrival_times_.size() - free_ids_.size();
+}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Returns number of rows in the table, which is the most customers
+ *          it has held at once
+ *
+ * @return Number of rows in each column
+ *
+ */
+size_t CustomerTable::row_count() const
+{
+    // Return rows.
+    return arrival_times_.size();
+}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Returns a boolean indicating whether the table has no customers
+ *
+ * @return Boolean value indicating whether the table has no customers
+ *
+ */
+bool CustomerTable::empty() const
+{
+    // Return empty status.
+    return size() == 0;
+}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Returns number indicating arrival time
+ *
+ * @return Unsigned integer value representing the customer's arrival time
+ *
+ */
+unsigned int CustomerTable::arrival_time(CustomerId id) const
+{
+    // Return arrival time.
+    return arrival_times_[id];
+}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Returns number indicating length of customer transaction
+ *
+ * @return Unsigned integer value representing the customer's transaction length
+ *
+ */
+unsigned int CustomerTable::transaction_length(CustomerId id) const
+{
+    // Return transaction length.
+    return transaction_lengths_[id];
+}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Returns number indicating customer's departure time
+ *
+ * @return Unsigned integer value representing the customer's departure time
+ *         (if not departed, value is 0)
+ *
+ */
+unsigned int CustomerTable::departure_time(CustomerId id) const
+{
+    // Return departure time.
+    return departure_times_[id];
+}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Sets customer departure time and returns boolean value indicating
+ *          success of operation
+ *
+ * @param[in] id
+ *            Customer whose transaction is starting
+ *
+ * @param[in] transaction_time
+ *            The time at which the transaction started
+ *
+ * @return Boolean value indicating whether or not the customer has already
+ *         completed a transaction
+ *
+ */
+bool CustomerTable::complete_transaction(CustomerId id, unsigned int transaction_time)
+{
+    // Transaction already completed?
+    if (departure_times_[id] > 0)
+    {
+        // Failure.
+        return false;
+    }
+
+    // Set departure time.
+    departure_times_[id] = transaction_time + transaction_lengths_[id];
+
+    // Success.
+    return true;
+}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Returns the contiguous arrival time column
+ *
+ * @return Pointer to the first of row_count() arrival times
+ *
+ */
+const unsigned int* CustomerTable::arrival_times() const
+{
+    // Return column.
+    return arrival_times_.data();
+}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Returns the contiguous transaction length column
+ *
+ * @return Pointer to the first of row_count() transaction lengths
+ *
+ */
+const unsigned int* CustomerTable::transaction_lengths() const
+{
+    // Return column.
+    return transaction_lengths_.data();
+}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Returns the contiguous departure time column
+ *
+ * @return Pointer to the first of row_count() departure times
+ *
+ */
+const unsigned int* CustomerTable::departure_times() const
+{
+    // Return column.
+    return departure_times_.data();
+}
+//
+//  Terminating Precompiler Directives  ////////////////////////////////////////
+//
+#endif // CUSTOMER_TABLE_CPP_
+//
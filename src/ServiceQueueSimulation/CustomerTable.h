@@ -0,0 +1,73 @@
+/**
+ *
+ * @file CustomerTable.h
+ *
+ * @brief Column-oriented store of simulated customers
+ *
+ * @author Josh Wiley
+ *
+ * @details Defines the CustomerTable class and the CustomerId type used to
+ *          refer to its rows. Rows are recycled once released, so a table
+ *          only grows to the peak number of customers held at once
+ *
+ */
+//
+//  Preprocessor Directives  ///////////////////////////////////////////////////
+//
+#ifndef CUSTOMER_TABLE_H_
+#define CUSTOMER_TABLE_H_
+//
+//  Header Files  //////////////////////////////////////////////////////////////
+//
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include <memory>
+#include "../Arena/ArenaAllocator.h"
+//
+//  Type Definitions  //////////////////////////////////////////////////////////
+//
+typedef std::uint32_t CustomerId; /**< Row of a customer in a CustomerTable */
+//
+//  Class Definition  //////////////////////////////////////////////////////////
+//
+class CustomerTable
+{
+
+// Public members.
+public:
+    CustomerTable(
+        size_t capacity = 0,
+        std::shared_ptr< Arena > arena_ptr = std::shared_ptr< Arena >(nullptr)
+    ); /**< Parameterized constructor */
+    CustomerTable(const CustomerTable&); /**< Copy constructor */
+    ~CustomerTable(); /**< Destructor */
+
+    CustomerId add(unsigned int, unsigned int); /**< Adds a customer in a released row (or a new one) and returns its id */
+    void release(CustomerId); /**< Frees a customer's row for reuse by a later add */
+    size_t size() const; /**< Returns number of customers held (rows not released) */
+    size_t row_count() const; /**< Returns number of rows, held or released */
+    bool empty() const; /**< Returns boolean indicating if there are no customers held */
+
+    unsigned int arrival_time(CustomerId) const; /**< Returns the time of arrival */
+    unsigned int transaction_length(CustomerId) const; /**< Returns the length of the transaction */
+    unsigned int departure_time(CustomerId) const; /**< Returns the time of departure (0 if not departed) */
+    bool complete_transaction(CustomerId, unsigned int); /**< Sets departure time */
+
+    const unsigned int* arrival_times() const; /**< Returns the arrival time column (row_count() rows) */
+    const unsigned int* transaction_lengths() const; /**< Returns the transaction length column (row_count() rows) */
+    const unsigned int* departure_times() const; /**< Returns the departure time column (row_count() rows) */
+
+// Private members.
+private:
+    std::vector< unsigned int, ArenaAllocator< unsigned int > > arrival_times_; /**< Time of arrival, by customer */
+    std::vector< unsigned int, ArenaAllocator< unsigned int > > transaction_lengths_; /**< Length of transaction, by customer */
+    std::vector< unsigned int, ArenaAllocator< unsigned int > > departure_times_; /**< Time of departure, by customer */
+    std::vector< CustomerId, ArenaAllocator< CustomerId > > free_ids_; /**< Released rows, reused most recent first */
+
+};
+//
+//  Terminating Precompiler Directives  ////////////////////////////////////////
+//
+#endif // CUSTOMER_TABLE_H_
+//
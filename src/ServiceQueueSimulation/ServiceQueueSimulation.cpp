@@ -7,7 +7,7 @@
  *
  * @author Josh Wiley
  *
- * @details Implements the ServiceQueueSimulation class
+ * @details Implements the BasicServiceQueueSimulation class template
  *
  */
 //
@@ -24,62 +24,95 @@
 //
 /**
  *
- * @details Templated constructor
+ * @details Templated constructor; every container owned by the simulation
+ *          draws from a per-simulation arena that is released in one shot
+ *          when the simulation is destroyed. When Lane
+ *          is a concrete (final) queue type, every queue call in the event
+ *          loop is statically dispatched; with Lane = Queue< CustomerId >
+ *          the lanes may be any mix of queue types. Customers are pulled
+ *          from the arrival source only as run() reaches them; lanes must
+ *          be empty, since customer ids refer to rows of the simulation's
+ *          own customer table (std::invalid_argument otherwise)
  *
- * @param[in] queues_ptr
- *            A smart pointer to the list of queues representing customers
- *
- * @param[in] servicers
+ * @param[in] num_servicers
  *            The number of servicers available to serve the queues of customers
  *
+ * @param[in] arrivals_ptr
+ *            A smart pointer to the source of customers, in order of arrival
+ *
+ * @param[in] queue_ptr
+ *            Smart pointer to the first queue of customer ids (convertible to
+ *            a smart pointer to Lane), or a vector of smart pointers to Lane
+ *            holding every queue when the lanes are only known at run time
+ *
+ * @param[in] rest_ptrs
+ *            Smart pointers to any other queues of customer ids
+ *
  */
+template< class Lane >
 template< class T, class ... V >
-ServiceQueueSimulation::ServiceQueueSimulation(
+BasicServiceQueueSimulation<Lane>::BasicServiceQueueSimulation(
     unsigned int num_servicers,
-    std::shared_ptr< std::list < Customer > > events_ptr,
+    std::shared_ptr< ArrivalSource > arrivals_ptr,
     T queue_ptr,
     V ... rest_ptrs
 )
-    : current_sim_time_(0)
+    : arena_(new Arena()),
+      current_sim_time_(0),
+      servicers_(ArenaAllocator< Servicer >(arena_)),
+      departure_calendar_(
+          std::allocate_shared< IndexedMinHeap< unsigned int > >(
+              ArenaAllocator< IndexedMinHeap< unsigned int > >(arena_),
+              num_servicers,
+              arena_
+          )
+      ),
+      idle_servicers_(num_servicers, true, arena_),
+      customer_queues_(ArenaAllocator< std::shared_ptr< Lane > >(arena_)),
+      shortest_queue_index_(lane_count(queue_ptr, rest_ptrs...), arena_),
+      head_of_line_index_(lane_count(queue_ptr, rest_ptrs...), arena_),
+      customers_(0, arena_),
+      customer_links_(
+          std::allocate_shared< QueueIntrusive< CustomerId >::LinkColumn >(
+              ArenaAllocator< QueueIntrusive< CustomerId >::LinkColumn >(arena_),
+              ArenaAllocator< CustomerId >(arena_)
+          )
+      ),
+      arrivals_(arrivals_ptr),
+      retain_trace_(false),
+      summary_threads_(0),
+      lane_lengths_(ArenaAllocator< TimeWeightedStatistics >(arena_)),
+      batch_buffer_(ArenaAllocator< CustomerId >(arena_)),
+      arrival_buffer_(ArenaAllocator< CustomerId >(arena_))
 {
-    // Events source iterators.
-    auto events_cursor_it = events_ptr->begin();
-    auto events_end_it = events_ptr->end();
-
-    // Construct events list from source.
-    while (events_cursor_it != events_end_it)
-    {
-        // Copy customer event.
-        customer_events_.push_back(
-            std::shared_ptr< Customer >(
-                new Customer(
-                    events_cursor_it->arrival_time(),
-                    events_cursor_it->transaction_length()
-                )
-            )
-        );
-
-        // Advance.
-        ++events_cursor_it;
-    }
-
     // Create servicers.
+    servicers_.reserve(num_servicers);
     for (auto i = (unsigned int) 0; i < num_servicers; i++)
     {
-        // Push new servicer to list.
-        servicers_.push_back(
-            std::shared_ptr< Servicer >( new Servicer() )
-        );
+        // Push new servicer.
+        servicers_.push_back(Servicer(i, departure_calendar_));
     }
     
     // Add queues.
+    customer_queues_.reserve(lane_count(queue_ptr, rest_ptrs...));
     add_queue(queue_ptr, rest_ptrs...);
 
-    // Add line length lists.
-    for (auto i = (unsigned int) 0; i < customer_queues_.size(); i++)
+    // Index lanes, which must start empty (ids only mean something once their customers are in the table).
+    lane_lengths_.reserve(customer_queues_.size());
+    for (auto i = (size_t) 0; i < customer_queues_.size(); i++)
     {
-        // Add list.
-        line_lengths_.push_back(std::list< unsigned int >());
+        // Loaded?
+        if (!customer_queues_[i]->empty())
+        {
+            // Reject.
+            throw std::invalid_argument("BasicServiceQueueSimulation: lanes must be empty; customers come from the arrival source");
+        }
+
+        // Add lane.
+        shortest_queue_index_.update(i, 0);
+
+        // Start length summary.
+        lane_lengths_.push_back(TimeWeightedStatistics(0, 0));
     }
 }
 //
@@ -87,18 +120,75 @@ ServiceQueueSimulation::ServiceQueueSimulation(
 //
 /**
  *
- * @details Copy-initializes object
+ * @details Parameterized constructor for a list of customers; the list is
+ *          read in place as run() reaches each customer, not copied up front
+ *
+ * @param[in] num_servicers
+ *            Number of servicers
  *
- * @param[in] origin
- *            Existing object from which the new object will be instantiated
- *            from
+ * @param[in] events_ptr
+ *            A smart pointer to the list of customers, sorted by arrival time
+ *
+ * @param[in] queue_ptr
+ *            Smart pointer to the first queue of customer ids (convertible to
+ *            a smart pointer to Lane)
+ *
+ * @param[in] rest_ptrs
+ *            Smart pointers to any other queues of customer ids
  *
  */
-ServiceQueueSimulation::ServiceQueueSimulation(const ServiceQueueSimulation& origin)
-    : current_sim_time_(origin.current_sim_time_), servicers_(origin.servicers_),
-      customer_queues_(origin.customer_queues_), customer_events_(origin.customer_events_),
-      start_time_(origin.start_time_), end_time_(origin.end_time_),
-      line_lengths_(origin.line_lengths_) {}
+template< class Lane >
+template< class T, class ... V >
+BasicServiceQueueSimulation<Lane>::BasicServiceQueueSimulation(
+    unsigned int num_servicers,
+    std::shared_ptr< std::list < Customer > > events_ptr,
+    T queue_ptr,
+    V ... rest_ptrs
+)
+    : BasicServiceQueueSimulation(
+          num_servicers,
+          std::shared_ptr< ArrivalSource >(new ListArrivalSource(events_ptr)),
+          queue_ptr,
+          rest_ptrs...
+      ) {}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Parameterized constructor for arrivals produced while the
+ *          simulation runs; run() pulls customers from the feed as it needs
+ *          them, waiting for the producer if it falls behind
+ *
+ * @param[in] num_servicers
+ *            Number of servicers
+ *
+ * @param[in] feed_ptr
+ *            Queue of customers in order of arrival, filled (and finally
+ *            closed) by a single producer thread
+ *
+ * @param[in] queue_ptr
+ *            Smart pointer to the first queue of customer ids (convertible to
+ *            a smart pointer to Lane)
+ *
+ * @param[in] rest_ptrs
+ *            Smart pointers to any other queues of customer ids
+ *
+ */
+template< class Lane >
+template< class T, class ... V >
+BasicServiceQueueSimulation<Lane>::BasicServiceQueueSimulation(
+    unsigned int num_servicers,
+    std::shared_ptr< QueueSpsc< Customer > > feed_ptr,
+    T queue_ptr,
+    V ... rest_ptrs
+)
+    : BasicServiceQueueSimulation(
+          num_servicers,
+          std::shared_ptr< ArrivalSource >(new FeedArrivalSource(feed_ptr)),
+          queue_ptr,
+          rest_ptrs...
+      ) {}
 //
 //  Class Member Implementation  ///////////////////////////////////////////////
 //
@@ -107,7 +197,8 @@ ServiceQueueSimulation::ServiceQueueSimulation(const ServiceQueueSimulation& ori
  * @details Destructor
  *
  */
-ServiceQueueSimulation::~ServiceQueueSimulation() {}
+template< class Lane >
+BasicServiceQueueSimulation<Lane>::~BasicServiceQueueSimulation() {}
 //
 //  Class Member Implementation  ///////////////////////////////////////////////
 //
@@ -118,7 +209,8 @@ ServiceQueueSimulation::~ServiceQueueSimulation() {}
  * @return Number of milliseconds that the simulation took to complete
  *
  */
-unsigned int ServiceQueueSimulation::time_elapsed() const
+template< class Lane >
+unsigned int BasicServiceQueueSimulation<Lane>::time_elapsed() const
 {
     // Return milliseconds elapsed.
     return std::chrono::duration_cast
@@ -137,7 +229,8 @@ unsigned int ServiceQueueSimulation::time_elapsed() const
  * @return Elapsed simulation time
  *
  */
-unsigned int ServiceQueueSimulation::sim_time() const
+template< class Lane >
+unsigned int BasicServiceQueueSimulation<Lane>::sim_time() const
 {
     // Return elapsed simulation time.
     return current_sim_time_;
@@ -147,188 +240,218 @@ unsigned int ServiceQueueSimulation::sim_time() const
 //
 /**
  *
- * @details Calculates and returns average customer wait time
+ * @details Returns average customer wait time, from the running sum kept as
+ *          customers start service
  *
- * @return Average wait time per customer
+ * @return Average wait time per customer (0 if no customer was served)
  *
  */
-float ServiceQueueSimulation::average_customer_wait_time() const 
+template< class Lane >
+float BasicServiceQueueSimulation<Lane>::average_customer_wait_time() const 
 {
-    // Get event iterators.
-    auto ce_cursor_it = customer_events_.begin();
-    auto ce_end_it = customer_events_.end();
-
-    // Total wait time.
-    auto total_wait = 0;
-    auto total_events = 0;
-
-    // Each events list.
-    while(ce_cursor_it != ce_end_it)
-    {
-        // Wait time.
-        total_wait += (*ce_cursor_it)->departure_time() - (*ce_cursor_it)->transaction_length() - (*ce_cursor_it)->arrival_time();
-
-        // Total.
-        total_events++;
-
-        // Advance.
-        ++ce_cursor_it;
-    }
-
     // Return.
-    return total_wait / total_events;
+    return (float) completions_.average_wait();
 }
 //
 //  Class Member Implementation  ///////////////////////////////////////////////
 //
 /**
  *
- * @details Computes and returns max customer wait time
+ * @details Returns max customer wait time
  *
  * @return Max wait time for all customers
  *
  */
-unsigned int ServiceQueueSimulation::max_customer_wait_time() const
+template< class Lane >
+unsigned int BasicServiceQueueSimulation<Lane>::max_customer_wait_time() const
 {
-    // Get event iterators.
-    auto ce_cursor_it = customer_events_.begin();
-    auto ce_end_it = customer_events_.end();
-
-    // Total wait time.
-    auto current_wait = 0;
-    auto max_wait = 0;
-
-    // Each events list.
-    while(ce_cursor_it != ce_end_it)
-    {
-        // Get wait time.
-        current_wait = (*ce_cursor_it)->departure_time() - (*ce_cursor_it)->transaction_length() - (*ce_cursor_it)->arrival_time();
-
-        // Is new max?
-        if (current_wait > max_wait)
-        {
-            // Assign new max.
-            max_wait = current_wait;
-        }
-
-        // Advance.
-        ++ce_cursor_it;
-    }
-
     // Return max.
-    return max_wait;
+    return completions_.max_wait();
+}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Returns the sample standard deviation of customer wait time
+ *
+ * @return Standard deviation of the wait time of served customers
+ *
+ */
+template< class Lane >
+float BasicServiceQueueSimulation<Lane>::customer_wait_time_deviation() const
+{
+    // Return.
+    return (float) completions_.waits().standard_deviation();
+}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Returns the wait time that the given percentage of customers waited
+ *          no longer than, from the wait histogram (within 1%, never under)
+ *
+ * @param[in] percentile
+ *            Percentage of customers, in [0, 100]
+ *
+ * @return Wait time at the percentile (0 if no customer was served)
+ *
+ */
+template< class Lane >
+unsigned int BasicServiceQueueSimulation<Lane>::customer_wait_time_percentile(double percentile) const
+{
+    // Return.
+    return completions_.wait_histogram().value_at_percentile(percentile);
+}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Returns average customer sojourn time (wait plus transaction)
+ *
+ * @return Average time from arrival to departure per customer (0 if no
+ *         customer was served)
+ *
+ */
+template< class Lane >
+float BasicServiceQueueSimulation<Lane>::average_customer_sojourn_time() const
+{
+    // Return.
+    return (float) completions_.average_sojourn();
+}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Returns max customer sojourn time (wait plus transaction)
+ *
+ * @return Max time from arrival to departure for all customers
+ *
+ */
+template< class Lane >
+unsigned int BasicServiceQueueSimulation<Lane>::max_customer_sojourn_time() const
+{
+    // Return max.
+    return completions_.max_sojourn();
+}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Returns the time in system that the given percentage of customers
+ *          spent no longer than, from the sojourn histogram (within 1%,
+ *          never under)
+ *
+ * @param[in] percentile
+ *            Percentage of customers, in [0, 100]
+ *
+ * @return Sojourn time at the percentile (0 if no customer was served)
+ *
+ */
+template< class Lane >
+unsigned int BasicServiceQueueSimulation<Lane>::customer_sojourn_time_percentile(double percentile) const
+{
+    // Return.
+    return completions_.sojourn_histogram().value_at_percentile(percentile);
 }
 //
 //  Class Member Implementation  ///////////////////////////////////////////////
 //
 /**
  *
- * @details Computes and returns average line length of simulation
+ * @details Returns the time-averaged length of the lines, averaged over the
+ *          lines (total waiting area over lanes times simulated time)
  *
  * @return Average line length of simulation
  *
  */
-float ServiceQueueSimulation::average_line_length() const
+template< class Lane >
+float BasicServiceQueueSimulation<Lane>::average_line_length() const
 {
-    // Line length iterators.
-    auto ll_cursor_it = line_lengths_.begin();
-    auto ll_end_it = line_lengths_.end();
-
-    // Sum.
-    auto sum = (unsigned int) 0;
-
-    // Average line lengths.
-    auto line_length_averages = std::list< float >();
-
-    while (ll_cursor_it != ll_end_it)
-    {
-        // Iterators.
-        auto cursor_it = ll_cursor_it->begin();
-        auto end_it = ll_cursor_it->end();
-
-        // Find sum.
-        while (cursor_it != end_it)
-        {
-            // Add.
-            sum += *cursor_it;
-
-            // Advance.
-            ++cursor_it;
-        }
-
-        // Add average to list.
-        line_length_averages.push_back(sum / ll_cursor_it->size());
-
-        // Clear sum.
-        sum = 0;
-
-        // Advance.
-        ++ll_cursor_it;
-    }
-
-    // Line averages iterators.
-    auto la_cursor_it = line_length_averages.begin();
-    auto la_end_it = line_length_averages.end();
-
-    // Find sum of the averages.
-    while (la_cursor_it != la_end_it)
-    {
-        // Add to sum.
-        sum += *la_cursor_it;
-        
-        // Advance.
-        ++la_cursor_it;
-    }
-
-    // Return average of averages.
-    return sum / line_length_averages.size();
+    // Return.
+    return (float) (customers_waiting_.mean(current_sim_time_) / lane_lengths_.size());
 }
 //
 //  Class Member Implementation  ///////////////////////////////////////////////
 //
 /**
  *
- * @details Returns max line length of simulation
+ * @details Returns the longest any line has been
  *
  * @return Max line length of simulation
  *
  */
-unsigned int ServiceQueueSimulation::max_line_length() const
+template< class Lane >
+unsigned int BasicServiceQueueSimulation<Lane>::max_line_length() const
 {
-    // Line update iterators.
-    auto ll_cursor_it = line_lengths_.begin();
-    auto ll_end_it = line_lengths_.end();
-
     // Max line length.
-    auto max_line_length = (unsigned int) 0;
+    auto max_line_length = (size_t) 0;
 
-    // Find max line length of all of the queues.
-    while (ll_cursor_it != ll_end_it)
+    // Each lane.
+    for (auto& lengths : lane_lengths_)
     {
-        // Iterators.
-        auto cursor_it = ll_cursor_it->begin();
-        auto end_it = ll_cursor_it->end();
-
-        // Find max.
-        while (cursor_it != end_it)
-        {
-            // Is max?
-            if (*cursor_it > max_line_length)
-            {
-                // Assign new max.
-                max_line_length = *cursor_it;
-            }
-
-            // Advance.
-            ++cursor_it;
-        }
-
-        // Advance.
-        ++ll_cursor_it;
+        // Longer?
+        max_line_length = std::max(max_line_length, lengths.max());
     }
 
     // Return.
-    return max_line_length;
+    return (unsigned int) max_line_length;
+}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Returns number of lines
+ *
+ * @return Number of customer queues (lanes)
+ *
+ */
+template< class Lane >
+size_t BasicServiceQueueSimulation<Lane>::line_count() const
+{
+    // Return.
+    return lane_lengths_.size();
+}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Returns the time-averaged length of one line
+ *
+ * @param[in] lane
+ *            Index of the line, in the order the queues were added
+ *
+ * @return Area under the line's length divided by the simulated time
+ *
+ */
+template< class Lane >
+float BasicServiceQueueSimulation<Lane>::average_lane_length(size_t lane) const
+{
+    // Return.
+    return (float) lane_lengths_[lane].mean(current_sim_time_);
+}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Returns the time-averaged number of customers waiting in all of
+ *          the lines together
+ *
+ * @return Area under the total number waiting divided by the simulated time
+ *
+ */
+template< class Lane >
+float BasicServiceQueueSimulation<Lane>::average_customers_waiting() const
+{
+    // Return.
+    return (float) customers_waiting_.mean(current_sim_time_);
 }
 //
 //  Class Member Implementation  ///////////////////////////////////////////////
@@ -340,7 +463,8 @@ unsigned int ServiceQueueSimulation::max_line_length() const
  * @return Smart pointer to a list of idle times for each servicer
  *
  */
-std::shared_ptr< std::list< unsigned int > > ServiceQueueSimulation::total_servicer_idle_times() const
+template< class Lane >
+std::shared_ptr< std::list< unsigned int > > BasicServiceQueueSimulation<Lane>::total_servicer_idle_times() const
 {
     // Pointer to list of idle times.
     auto totals_list_ptr = std::shared_ptr< std::list< unsigned int > >(
@@ -348,10 +472,10 @@ std::shared_ptr< std::list< unsigned int > > ServiceQueueSimulation::total_servi
     );
 
     // Add totals.
-    std::for_each(servicers_.begin(), servicers_.end(), [totals_list_ptr] (auto servicer_ptr)
+    std::for_each(servicers_.begin(), servicers_.end(), [totals_list_ptr] (const Servicer& servicer)
     {
         // Add idle time.
-        totals_list_ptr->push_back(servicer_ptr->total_idle_time());
+        totals_list_ptr->push_back(servicer.total_idle_time());
     });
 
     // Return.
@@ -360,32 +484,131 @@ std::shared_ptr< std::list< unsigned int > > ServiceQueueSimulation::total_servi
 //
 //  Class Member Implementation  ///////////////////////////////////////////////
 //
+/**
+ *
+ * @details Returns number of allocations drawn from the simulation's arena
+ *          (which moves with the simulation)
+ *
+ * @return Number of allocations drawn from the arena
+ *
+ */
+template< class Lane >
+size_t BasicServiceQueueSimulation<Lane>::arena_allocation_count() const
+{
+    // Return count.
+    return arena_->allocation_count();
+}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Returns number of bytes drawn from the simulation's arena (which
+ *          moves with the simulation)
+ *
+ * @return Number of bytes drawn from the arena
+ *
+ */
+template< class Lane >
+size_t BasicServiceQueueSimulation<Lane>::arena_bytes_allocated() const
+{
+    // Return bytes.
+    return arena_->bytes_allocated();
+}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Builds a report of the results so far from the running
+ *          statistics (each metric is read once, in O(lines + servicers))
+ *
+ * @return Report of the simulation's results
+ *
+ */
+template< class Lane >
+SimulationReport BasicServiceQueueSimulation<Lane>::report() const
+{
+    // Line averages.
+    auto line_lengths = std::vector< float >();
+    line_lengths.reserve(lane_lengths_.size());
+    for (auto i = (size_t) 0; i < lane_lengths_.size(); i++)
+    {
+        // Add.
+        line_lengths.push_back(average_lane_length(i));
+    }
+
+    // Idle times.
+    auto idle_times = std::vector< unsigned int >();
+    idle_times.reserve(servicers_.size());
+    for (auto& servicer : servicers_)
+    {
+        // Add.
+        idle_times.push_back(servicer.total_idle_time());
+    }
+
+    // Return.
+    return SimulationReport(
+        time_elapsed(),
+        sim_time(),
+        completions_,
+        average_line_length(),
+        max_line_length(),
+        average_customers_waiting(),
+        std::move(line_lengths),
+        std::move(idle_times),
+        arena_allocation_count(),
+        arena_bytes_allocated()
+    );
+}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Makes run() keep each customer's row (arrival, transaction, and
+ *          departure columns) instead of folding it into the completion
+ *          statistics as service starts, then summarize the whole trace
+ *          with the vectorized column kernels. Costs three words per
+ *          customer; call before run()
+ *
+ * @param[in] threads
+ *            Threads summarizing the trace (0 = one per core; 1 when the
+ *            simulation itself already runs on a worker thread)
+ *
+ */
+template< class Lane >
+void BasicServiceQueueSimulation<Lane>::retain_trace(unsigned int threads)
+{
+    // Retain.
+    retain_trace_ = true;
+    summary_threads_ = threads;
+}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
 /**
  *
  * @details Runs the simulation until the end
  *
+ * @return Report of the simulation's results
+ *
  */
-void ServiceQueueSimulation::run()
+template< class Lane >
+SimulationReport BasicServiceQueueSimulation<Lane>::run()
 {
     // Start time.
     start_time_ = std::chrono::high_resolution_clock::now();
 
-    // Event iterators.
-    auto next_arrival_it = customer_events_.begin();
-    auto end_it = customer_events_.end();
-    
     // Cached results.
-    auto next_arrival_time = (*next_arrival_it)->arrival_time();
+    auto next_arrival_time = (unsigned int) 0;
+    auto arrival_pending = peek_arrival(next_arrival_time);
     auto next_departure_time = (unsigned int) 0;
 
-    // Pointer to servicer and customer to process a transaction.
-    auto servicer_ptr = std::shared_ptr< Servicer >();
-    auto customer_ptr = std::shared_ptr< Customer>();
-
     // Pending events?
     while (
         // Arrival events to be processed?
-        next_arrival_it != end_it ||
+        arrival_pending ||
 
         // Departure events to be processed? 
         next_departure_time != 0 ||
@@ -397,7 +620,7 @@ void ServiceQueueSimulation::run()
         // Arrival?
         if (
             // If there is an arrival event to process.
-            next_arrival_it != end_it &&
+            arrival_pending &&
             (
                 // If there is no departure event.
                 next_departure_time == 0 ||
@@ -410,17 +633,30 @@ void ServiceQueueSimulation::run()
             // Advance time to next arrival.
             current_sim_time_ = next_arrival_time;
 
-            // Enqueue.
-            enqueue_to_shortest_queue(*next_arrival_it);
-
-            // Advance iterator.
-            ++next_arrival_it;
-
-            // Is the next arrival iterator is valid?
-            if (next_arrival_it != end_it)
+            // Every servicer busy?
+            if (idle_servicers_.none())
             {
-                // Cache new arrival time.
-                next_arrival_time = (*next_arrival_it)->arrival_time();
+                // Admit the arrivals sharing this time.
+                arrival_buffer_.clear();
+                while (arrival_pending && next_arrival_time == current_sim_time_)
+                {
+                    // Admit.
+                    arrival_buffer_.push_back(admit_arrival());
+
+                    // Advance.
+                    arrival_pending = peek_arrival(next_arrival_time);
+                }
+
+                // None of them can start service now, so enqueue together.
+                enqueue_arrivals(arrival_buffer_.data(), arrival_buffer_.data() + arrival_buffer_.size());
+            }
+            else
+            {
+                // Enqueue.
+                enqueue_to_shortest_queue(admit_arrival());
+
+                // Advance.
+                arrival_pending = peek_arrival(next_arrival_time);
             }
         }
         // Departure?
@@ -428,165 +664,365 @@ void ServiceQueueSimulation::run()
         {
             // Fast-forward to next departure time.
             current_sim_time_ = next_departure_time;
-        }
 
-        // Are waiting customers and servicers available?
-        while (is_servicer_available(servicer_ptr) && is_customer_waiting(customer_ptr))
-        {
-            // Service customer.
-            servicer_ptr->service_customer(current_sim_time_, customer_ptr);
+            // Free servicers that just finished.
+            release_servicers();
         }
 
+        // Serve waiting customers.
+        start_services();
+
         // Update next departure time.
         next_departure_time = get_next_departure_time();
     }
 
+    // Retained trace?
+    if (retain_trace_)
+    {
+        // Summarize every customer at once (no row was released).
+        completions_ = column_kernels::summarize_customers(
+            customers_.arrival_times(),
+            customers_.transaction_lengths(),
+            customers_.departure_times(),
+            customers_.row_count(),
+            summary_threads_
+        );
+    }
+
     // End time.
     end_time_ = std::chrono::high_resolution_clock::now();
+
+    // Return results.
+    return report();
 }
 //
 //  Class Member Implementation  ///////////////////////////////////////////////
 //
 /**
  *
- * @details Enqueues customer pointer to shortest queue
+ * @details Returns a boolean indicating whether an arrival remains, and the
+ *          time it arrives; the source is released once it runs out
+ *
+ * @param[out] arrival_time
+ *             Assigned the time of the next arrival, if there is one
  *
- * @param[in] customer_ptr
- *            Smart pointer to the customer that should be enqueued.
+ * @return Boolean value indicating whether an arrival remains
  *
  */
-void ServiceQueueSimulation::enqueue_to_shortest_queue(std::shared_ptr< Customer > customer_ptr)
+template< class Lane >
+bool BasicServiceQueueSimulation<Lane>::peek_arrival(unsigned int& arrival_time)
 {
-    // Pointer to shortest queue, cursor, and end.
-    auto shortest_queue_ptr_it = customer_queues_.begin();
-    auto cq_cursor_it = next(shortest_queue_ptr_it);
-    auto cq_end_it = customer_queues_.end();
-
-    // Line length iterators.
-    auto shortest_line_length_it = line_lengths_.begin();
-    auto ll_cursor_it = next(shortest_line_length_it);
-
-    // Find smallest queue.
-    while(cq_cursor_it != cq_end_it)
+    // Nothing to pull?
+    if (arrivals_ == nullptr)
     {
-        // Shorter than current shortest?
-        if ((*shortest_queue_ptr_it)->size() > (*cq_cursor_it)->size())
-        {
-            // Update new shortest queue.
-            shortest_queue_ptr_it = cq_cursor_it;
+        // Does not exist.
+        return false;
+    }
 
-            // Update iterator to appropriate line length list.
-            shortest_line_length_it = ll_cursor_it;
-        }
+    // Exhausted?
+    if (!arrivals_->peek_time(arrival_time))
+    {
+        // Release source.
+        arrivals_.reset();
 
-        // Advance.
-        ++cq_cursor_it;
-        ++ll_cursor_it;
+        // Does not exist.
+        return false;
     }
 
+    // Exists.
+    return true;
+}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Pulls the next arrival from the source into the customer table,
+ *          which hands out a row released by an earlier customer if it can;
+ *          only valid after peek_arrival returned true
+ *
+ * @return Id of the arriving customer
+ *
+ */
+template< class Lane >
+CustomerId BasicServiceQueueSimulation<Lane>::admit_arrival()
+{
+    // Pull.
+    auto arrival = Customer();
+    arrivals_->next(arrival);
+
+    // Add customer.
+    return customers_.add(arrival.arrival_time(), arrival.transaction_length());
+}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Enqueues customer id to shortest queue; ties go to the first
+ *          queue that was added
+ *
+ * @param[in] customer
+ *            Id of the customer that should be enqueued.
+ *
+ */
+template< class Lane >
+void BasicServiceQueueSimulation<Lane>::enqueue_to_shortest_queue(CustomerId customer)
+{
+    // Shortest lane.
+    auto lane = shortest_queue_index_.top();
+
     // Enqueue.
-    (*shortest_queue_ptr_it)->enqueue(customer_ptr);
+    customer_queues_[lane]->enqueue(customer);
 
     // Update line length.
-    shortest_line_length_it->push_back((*shortest_queue_ptr_it)->size());
+    record_lane_change(lane, customer_queues_[lane]->size() - 1);
 }
 //
 //  Class Member Implementation  ///////////////////////////////////////////////
 //
 /**
  *
- * @details Returns a boolean value indicating if all servicers are idle
+ * @details Enqueues a run of arrivals that share the current time while every
+ *          servicer is busy. Join-shortest-queue keeps sending customers to
+ *          the top lane until it passes the runner-up, so each such stretch
+ *          is placed with one enqueue_range call; placement matches enqueuing
+ *          the customers one at a time
  *
- * @return Boolean value indicating if all servicers are idle
+ * @param[in] first
+ *            Pointer to the id of the first arrival in the run
+ *
+ * @param[in] last
+ *            Pointer past the id of the last arrival in the run (ids are in
+ *            arrival order)
  *
  */
-bool ServiceQueueSimulation::all_servicers_idle() const
+template< class Lane >
+void BasicServiceQueueSimulation<Lane>::enqueue_arrivals(const CustomerId* first, const CustomerId* last)
 {
-    // Servicer iterators.
-    auto cursor_it = servicers_.begin();
-    auto end_it = servicers_.end();
-
-    // Check each servicer.
-    while (cursor_it != end_it)
+    // Place each stretch.
+    while (first != last)
     {
-        // Is servicer not available?
-        if (!(*cursor_it)->available(current_sim_time_))
+        // Shortest lane and its length.
+        auto lane = shortest_queue_index_.top();
+        auto length = shortest_queue_index_.top_key();
+
+        // Stretch length (all remaining arrivals if there is one lane).
+        auto count = (size_t) (last - first);
+
+        // Other lanes?
+        if (shortest_queue_index_.size() > 1)
         {
-            // Return.
-            return false;
+            // Runner-up lane.
+            auto runner_up = shortest_queue_index_.second();
+
+            // Customers this lane takes before the runner-up becomes shortest.
+            auto stretch = shortest_queue_index_.key(runner_up) - length + (lane < runner_up ? 1 : 0);
+
+            // Limit.
+            count = std::min(count, stretch);
         }
 
+        // Enqueue.
+        customer_queues_[lane]->enqueue_range(first, first + count);
+
+        // Update line lengths.
+        record_lane_change(lane, length);
+
         // Advance.
-        ++cursor_it;
+        first += count;
     }
-
-    // Return.
-    return true;
 }
 //
 //  Class Member Implementation  ///////////////////////////////////////////////
 //
 /**
  *
- * @details Returns a number indicating the time of the next departure event
- *
- * @return Unsigned integer indicating the time of the next departure event
+ * @details Starts service for waiting customers, longest wait first, while
+ *          servicers are available. When only one lane has customers, the
+ *          next starts all come from it, so as many as there are idle
+ *          servicers are taken with one dequeue_batch call
  *
  */
-unsigned int ServiceQueueSimulation::get_next_departure_time() const
+template< class Lane >
+void BasicServiceQueueSimulation<Lane>::start_services()
 {
-    // Servicer iterators.
-    auto s_cursor_it = servicers_.begin();
-    auto s_end_it = servicers_.end();
-
-    // Next departure time.
-    auto departure_times = std::list< unsigned int >();
+    // Servicer and customer to process a transaction.
+    auto servicer = (size_t) 0;
+    auto customer = (CustomerId) 0;
 
-    // Check each servicer.
-    while (s_cursor_it != s_end_it)
+    // Only one loaded lane and idle servicers?
+    if (head_of_line_index_.size() == 1 && !idle_servicers_.none())
     {
-        // Check.
-        if (!(*s_cursor_it)->available(current_sim_time_))
+        // Loaded lane.
+        auto lane = head_of_line_index_.top();
+        auto length = customer_queues_[lane]->size();
+
+        // Take up to one customer per idle servicer.
+        batch_buffer_.resize(std::min(length, idle_servicers_.count()));
+        auto count = customer_queues_[lane]->dequeue_batch(batch_buffer_.data(), batch_buffer_.size());
+
+        // Update line lengths.
+        record_lane_change(lane, length);
+
+        // Serve in order.
+        for (auto i = (size_t) 0; i < count; i++)
         {
-            // Get departure time.
-            departure_times.push_back((*s_cursor_it)->unavailable_until());
+            // First available servicer.
+            is_servicer_available(servicer);
+
+            // Service customer.
+            start_service(servicer, batch_buffer_[i]);
         }
+    }
 
-        // Advance.
-        ++s_cursor_it;
+    // Are waiting customers and servicers available?
+    while (is_servicer_available(servicer) && is_customer_waiting(customer))
+    {
+        // Service customer.
+        start_service(servicer, customer);
+    }
+}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Has the servicer serve the customer at the current time and marks
+ *          the servicer busy if the transaction takes any time
+ *
+ * @param[in] servicer
+ *            Index of an available servicer
+ *
+ * @param[in] customer
+ *            Id of the customer to serve
+ *
+ */
+template< class Lane >
+void BasicServiceQueueSimulation<Lane>::start_service(size_t servicer, CustomerId customer)
+{
+    // Retaining the trace?
+    if (retain_trace_)
+    {
+        // Service customer, keeping its row for the summary.
+        servicers_[servicer].service_customer(current_sim_time_, customers_, customer);
+    }
+    else
+    {
+        // Service customer.
+        servicers_[servicer].service_customer(current_sim_time_, customers_, customer, completions_);
     }
 
-    // Are all servicers available?
-    if (departure_times.empty())
+    // Busy past the current time?
+    if (!servicers_[servicer].available(current_sim_time_))
     {
-        // Return 0.
-        return 0;
+        // Mark busy.
+        idle_servicers_.reset(servicer);
     }
+}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Moves the lane's length summary and the total waiting summary to
+ *          the lane's new length at the current time, updates the
+ *          join-shortest-queue index, and re-keys the lane's front customer
+ *          in the head-of-line index
+ *
+ * @param[in] lane
+ *            Index of the lane that was enqueued to or dequeued from
+ *
+ * @param[in] previous_length
+ *            Length of the lane before the change
+ *
+ */
+template< class Lane >
+void BasicServiceQueueSimulation<Lane>::record_lane_change(size_t lane, size_t previous_length)
+{
+    // Current length.
+    auto length = customer_queues_[lane]->size();
 
-    // Get departure time iterators.
-    auto dt_cursor_it = departure_times.begin();
-    auto dt_end_it = departure_times.end();
+    // Update length summaries.
+    lane_lengths_[lane].update(current_sim_time_, length);
+    customers_waiting_.update(current_sim_time_, customers_waiting_.level() + length - previous_length);
 
-    // Get first value and advance cursor.
-    auto next_departure_time = *dt_cursor_it;
-    ++dt_cursor_it;
+    // Update length index.
+    shortest_queue_index_.update(lane, length);
 
-    // Find smallest.
-    while (dt_cursor_it != dt_end_it)
+    // Empty?
+    if (length == 0)
     {
-        // Check.
-        if (*dt_cursor_it < next_departure_time)
-        {
-            // New next departure time.
-            next_departure_time = *dt_cursor_it;
-        }
+        // Nobody waiting at the front.
+        head_of_line_index_.erase(lane);
+    }
+    else
+    {
+        // Update front (unchanged unless the lane was empty or dequeued).
+        head_of_line_index_.update(lane, customers_.arrival_time(customer_queues_[lane]->front()));
+    }
+}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Returns a boolean value indicating if all servicers are idle
+ *
+ * @return Boolean value indicating if all servicers are idle
+ *
+ */
+template< class Lane >
+bool BasicServiceQueueSimulation<Lane>::all_servicers_idle() const
+{
+    // Return.
+    return idle_servicers_.all();
+}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Removes calendar entries that are not after the current simulation
+ *          time and marks those servicers as available
+ *
+ */
+template< class Lane >
+void BasicServiceQueueSimulation<Lane>::release_servicers()
+{
+    // Past departures?
+    while (!departure_calendar_->empty() && departure_calendar_->top_key() <= current_sim_time_)
+    {
+        // Mark available.
+        idle_servicers_.set(departure_calendar_->top());
 
-        // Advance.
-        ++dt_cursor_it;
+        // Remove.
+        departure_calendar_->pop();
+    }
+}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Returns a number indicating the time of the next departure event
+ *
+ * @return Unsigned integer indicating the time of the next departure event,
+ *         or 0 if all servicers are available
+ *
+ */
+template< class Lane >
+unsigned int BasicServiceQueueSimulation<Lane>::get_next_departure_time() const
+{
+    // Are all servicers available?
+    if (departure_calendar_->empty())
+    {
+        // Return 0.
+        return 0;
     }
 
     // Return.
-    return next_departure_time;
+    return departure_calendar_->top_key();
 }
 //
 //  Class Member Implementation  ///////////////////////////////////////////////
@@ -596,108 +1032,31 @@ unsigned int ServiceQueueSimulation::get_next_departure_time() const
  * @details Returns a boolean value indicating if there are any customers
  *          waiting for service
  *
- * @param[out] next_customer_ptr
- *             Pointer to be assigned the customer who has been waiting the longest.
+ * @param[out] next_customer
+ *             Id to be assigned the customer who has been waiting the longest.
  *
  * @return Boolean value indicating if there are any customers waiting for
  *         service
  *
  */
-bool ServiceQueueSimulation::is_customer_waiting(std::shared_ptr< Customer >& next_customer_ptr)
+template< class Lane >
+bool BasicServiceQueueSimulation<Lane>::is_customer_waiting(CustomerId& next_customer)
 {
-    // Get queue iterators.
-    auto cq_cursor_it = customer_queues_.begin();
-    auto cq_end_it = customer_queues_.end();
-
-    // List of queue pointers.
-    auto loaded_queues = std::list< std::shared_ptr< Queue < std::shared_ptr< Customer > > > >();
-
-    // Line length iterators.
-    auto ll_cursor_it = line_lengths_.begin();
-
-    // List of iterators pointing to line lengths associated with the loaded queues.
-    auto line_lenghts_its = std::list< std::list< std::list< unsigned int > >::iterator >();
-
-    // Check each.
-    while (cq_cursor_it != cq_end_it)
-    {
-        // Not empty?
-        if (!(*cq_cursor_it)->empty())
-        {
-            // Add to lists.
-            loaded_queues.push_back(*cq_cursor_it);
-            line_lenghts_its.push_back(ll_cursor_it);
-        }
-
-        // Advance.
-        ++cq_cursor_it;
-        ++ll_cursor_it;
-    }
-
     // If no queues with customers, return.
-    if (loaded_queues.empty())
+    if (head_of_line_index_.empty())
     {
         // Return.
         return false;
     }
 
-    // Get loaded queue iterators.
-    auto lq_cursor_it = loaded_queues.begin();
-    auto lq_end_it = loaded_queues.end();
-
-    // Loaded line length iterators.
-    auto lll_cursor_it = line_lenghts_its.begin();
-
-    // Queue to dequeue from.
-    auto queue_to_dequeue_from_ptr = std::shared_ptr< Queue < std::shared_ptr< Customer > > >
-        (*lq_cursor_it);
-    auto lll_to_dequeue_from = *lll_cursor_it;
+    // Lane with the earliest arrival at its front (ties go to the first lane).
+    auto lane = head_of_line_index_.top();
 
-    // Get first customer arrival time.
-    auto earliest_arrival_time =
-        queue_to_dequeue_from_ptr
-            ->peek()
-            ->arrival_time();
-
-    // Advance.
-    ++lq_cursor_it;
-    ++lll_cursor_it;
-
-    // Get queue to dequeue from.
-    while (lq_cursor_it != lq_end_it)
-    {
-        // Is earlier arrival time.
-        if ((*lq_cursor_it)->peek()->arrival_time() < earliest_arrival_time)
-        {
-            // Save queue pointer.
-            queue_to_dequeue_from_ptr =
-                std::shared_ptr
-                    < Queue < std::shared_ptr< Customer > > >
-                    (*lq_cursor_it);
-
-            // Save new arrival time.
-            earliest_arrival_time =
-                queue_to_dequeue_from_ptr
-                    ->peek()
-                    ->arrival_time();
-            
-            // Save iterator to list to keep track of line updates.
-            lll_to_dequeue_from = *lll_cursor_it;
-        }
-
-        // Advance.
-        ++lq_cursor_it;
-        ++lll_cursor_it;
-    }
-
-    // Save.
-    next_customer_ptr = queue_to_dequeue_from_ptr->peek();
-
-    // Dequeue.
-    queue_to_dequeue_from_ptr->dequeue();
+    // Take front customer.
+    customer_queues_[lane]->try_pop(next_customer);
 
     // Update line length.
-    lll_to_dequeue_from->push_back(queue_to_dequeue_from_ptr->size());
+    record_lane_change(lane, customer_queues_[lane]->size() + 1);
 
     // Return.
     return true;
@@ -710,36 +1069,19 @@ bool ServiceQueueSimulation::is_customer_waiting(std::shared_ptr< Customer >& ne
  * @details Returns a boolean value indicating if a servicer is available
  *
  * @param[out] available_servicer
- *             Pointer to assign an available servicer to
+ *             Index of the first available servicer
  *
  * @return Boolean value indicating if a servicer is available
  *
  */
-bool ServiceQueueSimulation::is_servicer_available(std::shared_ptr< Servicer >& available_servicer) const
+template< class Lane >
+bool BasicServiceQueueSimulation<Lane>::is_servicer_available(size_t& available_servicer) const
 {
-    // Get servicer iterators.
-    auto cursor_it = servicers_.begin();
-    auto end_it = servicers_.end();
-
-    // Check each.
-    while (cursor_it != end_it)
-    {
-        // Available?
-        if ((*cursor_it)->available(current_sim_time_))
-        {
-            // Save out parameter.
-            available_servicer = *cursor_it;
-
-            // Return.
-            return true;
-        }
-
-        // Advance.
-        ++cursor_it;
-    }
+    // First available.
+    available_servicer = idle_servicers_.find_first();
 
     // Return.
-    return false;
+    return available_servicer < servicers_.size();
 }
 //
 //  Class Member Implementation  ///////////////////////////////////////////////
@@ -756,8 +1098,9 @@ bool ServiceQueueSimulation::is_servicer_available(std::shared_ptr< Servicer >&
  *            Parameter pack of smart pointers to customer queues
  *
  */
+template < class Lane >
 template < class T, class ... V >
-void ServiceQueueSimulation::add_queue(T queue_ptr, V ... rest_ptrs)
+void BasicServiceQueueSimulation<Lane>::add_queue(T queue_ptr, V ... rest_ptrs)
 {
     // Add and recurse (kinda).
     add_queue(queue_ptr);
@@ -775,13 +1118,109 @@ void ServiceQueueSimulation::add_queue(T queue_ptr, V ... rest_ptrs)
  *            Smart pointer to queue to be added
  *
  */
+template < class Lane >
 template < class T >
-void ServiceQueueSimulation::add_queue(T queue_ptr)
+void BasicServiceQueueSimulation<Lane>::add_queue(T queue_ptr)
 {
     // Add queue.
     customer_queues_.push_back(queue_ptr);
 }
 //
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Adds an intrusive queue after pointing it at the simulation's
+ *          customer links, so waiting customers are linked in place and the
+ *          lane itself never allocates
+ *
+ * @param[in] queue_ptr
+ *            Smart pointer to the (empty) intrusive queue to be added
+ *
+ */
+template < class Lane >
+void BasicServiceQueueSimulation<Lane>::add_queue(std::shared_ptr< QueueIntrusive< CustomerId > > queue_ptr)
+{
+    // Share customer links.
+    queue_ptr->attach(customer_links_);
+
+    // Add queue.
+    customer_queues_.push_back(queue_ptr);
+}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Adds every queue of a vector, attaching intrusive queues to the
+ *          customer links (found at run time, since the vector's lanes may
+ *          be any mix of queue types)
+ *
+ * @param[in] queue_ptrs
+ *            Smart pointers to the queues to be added, in lane order
+ *
+ */
+template < class Lane >
+void BasicServiceQueueSimulation<Lane>::add_queue(std::vector< std::shared_ptr< Lane > > queue_ptrs)
+{
+    // Each queue.
+    for (auto& queue_ptr : queue_ptrs)
+    {
+        // Intrusive?
+        auto intrusive_ptr = std::dynamic_pointer_cast< QueueIntrusive< CustomerId > >(queue_ptr);
+        if (intrusive_ptr != nullptr)
+        {
+            // Share customer links.
+            intrusive_ptr->attach(customer_links_);
+        }
+
+        // Add queue.
+        customer_queues_.push_back(queue_ptr);
+    }
+}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Returns number of lanes a constructor's queue arguments make
+ *
+ * @param[in] queue_ptr
+ *            Smart pointer to the first queue
+ *
+ * @param[in] rest_ptrs
+ *            Smart pointers to any other queues
+ *
+ * @return Number of queues passed
+ *
+ */
+template < class Lane >
+template < class T, class ... V >
+size_t BasicServiceQueueSimulation<Lane>::lane_count(const T& queue_ptr, const V& ... rest_ptrs)
+{
+    // Return.
+    return 1 + sizeof...(rest_ptrs);
+}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Returns number of lanes a vector of queues makes
+ *
+ * @param[in] queue_ptrs
+ *            Smart pointers to the queues
+ *
+ * @return Number of queues in the vector
+ *
+ */
+template < class Lane >
+size_t BasicServiceQueueSimulation<Lane>::lane_count(const std::vector< std::shared_ptr< Lane > >& queue_ptrs)
+{
+    // Return.
+    return queue_ptrs.size();
+}
+//
 //  Terminating Precompiler Directives  ////////////////////////////////////////
 //
 #endif // SERVICE_QUEUE_SIMULATION_CPP_
@@ -7,7 +7,8 @@
  *
  * @author Josh Wiley
  *
- * @details Defines the ServiceQueueSimulation class
+ * @details Defines the BasicServiceQueueSimulation class template and the
+ *          ServiceQueueSimulation alias for lanes of mixed queue types
  *
  */
 //
@@ -20,57 +21,128 @@
 //
 #include <memory>
 #include <list>
+#include <vector>
 #include <iterator>
 #include <chrono>
 #include <algorithm>
+#include <utility>
+#include <stdexcept>
 #include "../Queue/Queue.h"
 #include "../Queue/QueueList.h"
+#include "../Queue/QueueChunkList.h"
+#include "../Queue/QueueIntrusive.h"
+#include "../Queue/QueueSpsc.h"
+#include "../Queue/QueueMpmc.h"
 #include "../Queue/QueueArray.h"
+#include "../Arena/Arena.h"
+#include "../Arena/ArenaAllocator.h"
+#include "../IndexedHeap/IndexedMinHeap.h"
+#include "../DynamicBitset/DynamicBitset.h"
+#include "../ArrivalSource/ArrivalSource.h"
+#include "../ArrivalSource/ListArrivalSource.h"
+#include "../ArrivalSource/FeedArrivalSource.h"
+#include "../Statistics/TimeWeightedStatistics.h"
+#include "../utils/column_kernels.h"
 #include "Servicer.h"
 #include "Customer.h"
+#include "CustomerTable.h"
+#include "CompletionSink.h"
+#include "SimulationReport.h"
 //
 //  Class Definition  //////////////////////////////////////////////////////////
 //
-class ServiceQueueSimulation
+template<class Lane>
+class BasicServiceQueueSimulation
 {
 
 // Public members.
 public:
     template<class T, class ... V>
-    ServiceQueueSimulation(
+    BasicServiceQueueSimulation(
+        unsigned int num_servicers,
+        std::shared_ptr< ArrivalSource >,
+        T, V...
+    ); /**< Parameterized constructor (lanes must be empty) */
+    template<class T, class ... V>
+    BasicServiceQueueSimulation(
         unsigned int num_servicers,
         std::shared_ptr< std::list < Customer > >,
         T, V...
-    ); /**< Parameterized constructor */
-    ServiceQueueSimulation(const ServiceQueueSimulation&); /**< Copy constructor */
-    ~ServiceQueueSimulation(); /**< Destructor */
+    ); /**< Parameterized constructor (list of customers) */
+    template<class T, class ... V>
+    BasicServiceQueueSimulation(
+        unsigned int num_servicers,
+        std::shared_ptr< QueueSpsc< Customer > >,
+        T, V...
+    ); /**< Parameterized constructor (arrivals streamed from another thread) */
+    BasicServiceQueueSimulation(const BasicServiceQueueSimulation< Lane >&) = delete; /**< Not copyable (servicers and intrusive lanes are bound to the simulation's own calendar and links) */
+    BasicServiceQueueSimulation(BasicServiceQueueSimulation< Lane >&&) = default; /**< Move constructor (the calendar and links move with their owners) */
+    ~BasicServiceQueueSimulation(); /**< Destructor */
 
     unsigned int time_elapsed() const; /**< Amount of time (ms) that the simulation took to finish, or has been running for */
     unsigned int sim_time() const; /**< Total time units passed in simulation */
     float average_customer_wait_time() const; /**< Average customer wait time */
     unsigned int max_customer_wait_time() const; /**< Maximum customer wait time */
-    float average_line_length() const; /**< Average length of line */
+    float customer_wait_time_deviation() const; /**< Standard deviation of customer wait time */
+    unsigned int customer_wait_time_percentile(double) const; /**< Customer wait time at a percentile */
+    float average_customer_sojourn_time() const; /**< Average time from arrival to departure */
+    unsigned int max_customer_sojourn_time() const; /**< Maximum time from arrival to departure */
+    unsigned int customer_sojourn_time_percentile(double) const; /**< Time from arrival to departure at a percentile */
+    float average_line_length() const; /**< Time-averaged length of a line, averaged over the lines */
     unsigned int max_line_length() const; /**< Maximum length of line */
+    size_t line_count() const; /**< Number of lines (customer queues) */
+    float average_lane_length(size_t) const; /**< Time-averaged length of one line */
+    float average_customers_waiting() const; /**< Time-averaged number of customers waiting in all lines */
     std::shared_ptr< std::list< unsigned int > > total_servicer_idle_times() const; /**< Total idle times for each servicer */
+    size_t arena_allocation_count() const; /**< Number of allocations the simulation has drawn from its arena */
+    size_t arena_bytes_allocated() const; /**< Number of bytes the simulation has drawn from its arena */
+
+    SimulationReport report() const; /**< Snapshot of every result, built from the running statistics */
+
+    void retain_trace(unsigned int threads = 0); /**< Keeps every customer's row so run() summarizes completions from the whole trace in one batched pass */
+    SimulationReport run(); /**< Runs simulation until customer queues are empty and returns its report */
 
-    void run(); /**< Runs simulation until customer queues are empty */
+    BasicServiceQueueSimulation< Lane >& operator=(const BasicServiceQueueSimulation< Lane >&) = delete; /**< Not assignable */
 
 // Private members.
 private:
+    std::shared_ptr< Arena > arena_; /**< Arena backing every container owned by the simulation (declared first so it is created first) */
     unsigned int current_sim_time_; /**< Amount of time units that have passed in the simulation */
-    std::list< std::shared_ptr< Servicer > > servicers_; /**< List of servicers */
-    std::list< std::shared_ptr< Queue < std::shared_ptr< Customer > > > > customer_queues_; /**< List of customer queues */
-    std::list< std::shared_ptr< Customer > > customer_events_; /** List of pointers to lists of customer arrival events */
+    std::vector< Servicer, ArenaAllocator< Servicer > > servicers_; /**< Servicers, indexed by servicer */
+    std::shared_ptr< IndexedMinHeap< unsigned int > > departure_calendar_; /**< Departure times of busy servicers, indexed by servicer */
+    DynamicBitset idle_servicers_; /**< Bit per servicer, set while the servicer is available */
+    std::vector<
+        std::shared_ptr< Lane >,
+        ArenaAllocator< std::shared_ptr< Lane > >
+    > customer_queues_; /**< Customer queues (lanes), indexed by lane */
+    IndexedMinHeap< size_t > shortest_queue_index_; /**< Lane lengths, indexed by lane, for join-shortest-queue */
+    IndexedMinHeap< unsigned int > head_of_line_index_; /**< Arrival time of each non-empty lane's front customer, indexed by lane */
+    CustomerTable customers_; /**< Customers waiting for service, stored by column (rows are released once service starts) */
+    std::shared_ptr< QueueIntrusive< CustomerId >::LinkColumn > customer_links_; /**< Next customer in line, indexed by customer, shared by every intrusive lane */
+    std::shared_ptr< ArrivalSource > arrivals_; /**< Source of arrivals not yet added to the customer table (null once exhausted) */
+    CompletionSink completions_; /**< Wait and sojourn statistics of customers whose service has started (at the end of run() when the trace is retained) */
+    bool retain_trace_; /**< Keep customer rows and summarize them after the run? */
+    unsigned int summary_threads_; /**< Threads summarizing a retained trace (0 = one per core) */
 
     std::chrono::time_point< std::chrono::high_resolution_clock > start_time_; /**< Start time of simulation */
     std::chrono::time_point< std::chrono::high_resolution_clock > end_time_; /**< End time of simulation */
-    std::list< std::list< unsigned int > > line_lengths_; /**< List of line lengths, parallel to the customer queues, containing their lengths after each event. */
+    std::vector< TimeWeightedStatistics, ArenaAllocator< TimeWeightedStatistics > > lane_lengths_; /**< Length of each lane over time, parallel to the customer queues */
+    TimeWeightedStatistics customers_waiting_; /**< Number of customers waiting in all lanes over time */
+    std::vector< CustomerId, ArenaAllocator< CustomerId > > batch_buffer_; /**< Scratch space for batched dequeues */
+    std::vector< CustomerId, ArenaAllocator< CustomerId > > arrival_buffer_; /**< Scratch space for a run of simultaneous arrivals */
 
-    void enqueue_to_shortest_queue(std::shared_ptr< Customer >); /**< Enqueues customer to shortest queue */
+    bool peek_arrival(unsigned int&); /**< Returns boolean value indicating if an arrival remains, and returns its time via out parameter */
+    CustomerId admit_arrival(); /**< Adds the next arrival to the customer table and returns its id */
+    void enqueue_to_shortest_queue(CustomerId); /**< Enqueues customer to shortest queue */
+    void enqueue_arrivals(const CustomerId*, const CustomerId*); /**< Enqueues a run of simultaneous arrivals that cannot start service, in per-lane batches */
+    void start_services(); /**< Starts service for waiting customers while servicers are available */
+    void start_service(size_t, CustomerId); /**< Starts service for a customer with a servicer */
+    void record_lane_change(size_t, size_t); /**< Records a lane's new length and front customer after it changes from the given length */
     bool all_servicers_idle() const; /**< Return boolean value indicating if all servicers are idle. */
+    void release_servicers(); /**< Marks servicers whose departure is not after the current time as available */
     unsigned int get_next_departure_time() const; /**< Returns next customer departure time */
-    bool is_customer_waiting(std::shared_ptr< Customer >&); /**< Returns boolean value indicating if customers are waiting in the queue, and returns a pointer to the customer who has been waiting the longest */
-    bool is_servicer_available(std::shared_ptr< Servicer >&) const; /**< Returns boolean value indicating if servicers are available, and returns a pointer the first available servicer via out parameter */
+    bool is_customer_waiting(CustomerId&); /**< Returns boolean value indicating if customers are waiting in the queue, and returns the id of the customer who has been waiting the longest */
+    bool is_servicer_available(size_t&) const; /**< Returns boolean value indicating if servicers are available, and returns the index of the first available servicer via out parameter */
 
     template < class T, class ... V >
     void add_queue(T, V...); /**< Variadic template to add queue and recurse (kinda) */
@@ -78,8 +150,21 @@ private:
     template < class T >
     void add_queue(T); /**< Variadic template to add queue */
 
+    void add_queue(std::shared_ptr< QueueIntrusive< CustomerId > >); /**< Attaches an intrusive queue to the customer links and adds it */
+
+    void add_queue(std::vector< std::shared_ptr< Lane > >); /**< Adds every queue of a vector (lanes chosen at run time), attaching intrusive ones */
+
+    template < class T, class ... V >
+    static size_t lane_count(const T&, const V& ...); /**< Number of lanes given as separate queue arguments */
+
+    static size_t lane_count(const std::vector< std::shared_ptr< Lane > >&); /**< Number of lanes given as a vector */
+
 };
 //
+//  Type Definitions  //////////////////////////////////////////////////////////
+//
+typedef BasicServiceQueueSimulation< Queue< CustomerId > > ServiceQueueSimulation; /**< Simulation over lanes of any mix of queue types (virtual dispatch) */
+//
 //  Implementation Files  //////////////////////////////////////////////////////
 //
 #include "ServiceQueueSimulation.cpp"
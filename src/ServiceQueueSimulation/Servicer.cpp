@@ -27,7 +27,23 @@
  *
  */
 Servicer::Servicer()
-    : unavailable_until_(0), total_idle_time_(0) {}
+    : id_(0), unavailable_until_(0), total_idle_time_(0) {}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Creates a servicer that reports its departures to a calendar
+ *
+ * @param[in] id
+ *            Index of the servicer in the departure calendar
+ *
+ * @param[in] departure_calendar
+ *            Calendar to keep updated with the time the servicer is busy until
+ *
+ */
+Servicer::Servicer(unsigned int id, std::shared_ptr< IndexedMinHeap< unsigned int > > departure_calendar)
+    : id_(id), departure_calendar_(departure_calendar), unavailable_until_(0), total_idle_time_(0) {}
 //
 //  Class Member Implementation  ///////////////////////////////////////////////
 //
@@ -40,7 +56,8 @@ Servicer::Servicer()
  *
  */
 Servicer::Servicer(const Servicer& origin)
-    : unavailable_until_(origin.unavailable_until_), total_idle_time_(origin.total_idle_time_) {}
+    : id_(origin.id_), departure_calendar_(origin.departure_calendar_),
+      unavailable_until_(origin.unavailable_until_), total_idle_time_(origin.total_idle_time_) {}
 //
 //  Class Member Implementation  ///////////////////////////////////////////////
 //
@@ -55,25 +72,89 @@ Servicer::~Servicer() {}
 //
 /**
  *
- * @details Services customer and updates availability
+ * @details Services customer (see the overload without a sink). The
+ *          customer's departure is settled once service starts, so its times
+ *          are folded into the sink and its row is released for reuse
+ *
+ * @param[in] current_time
+ *            Time at which the servicing is requested
+ *
+ * @param[out] customers
+ *             Table holding the customer, allows servicer to update its state
+ *
+ * @param[in] customer
+ *            Id of the customer to service
+ *
+ * @param[out] completions
+ *             Statistics the customer's wait and sojourn are added to
+ *
+ */
+void Servicer::service_customer(
+    unsigned int current_time,
+    CustomerTable& customers,
+    CustomerId customer,
+    CompletionSink& completions
+)
+{
+    // Service customer.
+    service_customer(current_time, customers, customer);
+
+    // Record and release customer.
+    completions.record(customers.arrival_time(customer), current_time, customers.departure_time(customer));
+    customers.release(customer);
+}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Services customer and updates availability, rescheduling the
+ *          servicer's departure in the calendar (if one was provided). The
+ *          customer's row stays in the table with its departure time set
  *
  * @param[in] current_time
  *            Time at which the servicing is requested
  *
- * @param[out] customer_ptr
- *             Allows servicer to update state of customer
+ * @param[out] customers
+ *             Table holding the customer, allows servicer to update its state
+ *
+ * @param[in] customer
+ *            Id of the customer to service
  *
  */
-void Servicer::service_customer(unsigned int current_time, std::shared_ptr< Customer > customer_ptr)
+void Servicer::service_customer(
+    unsigned int current_time,
+    CustomerTable& customers,
+    CustomerId customer
+)
 {
     // Complete transaction.
-    customer_ptr->complete_transaction(current_time);
+    customers.complete_transaction(customer, current_time);
 
     // Update idle time.
     total_idle_time_ += current_time - unavailable_until_;
 
     // Update availability.
-    unavailable_until_ = current_time + customer_ptr->transaction_length();
+    unavailable_until_ = current_time + customers.transaction_length(customer);
+
+    // No calendar?
+    if (departure_calendar_ == nullptr)
+    {
+        // Return.
+        return;
+    }
+
+    // Busy past the current time?
+    if (unavailable_until_ > current_time)
+    {
+        // Schedule departure.
+        departure_calendar_->update(id_, unavailable_until_);
+    }
+    else
+    {
+        // Nothing to schedule.
+        departure_calendar_->erase(id_);
+    }
 }
 //
 //  Class Member Implementation  ///////////////////////////////////////////////
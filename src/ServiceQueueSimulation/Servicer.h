@@ -18,7 +18,9 @@
 //  Header Files  //////////////////////////////////////////////////////////////
 //
 #include <memory>
-#include "Customer.h"
+#include "../IndexedHeap/IndexedMinHeap.h"
+#include "CustomerTable.h"
+#include "CompletionSink.h"
 //
 //  Class Definition  //////////////////////////////////////////////////////////
 //
@@ -28,16 +30,20 @@ class Servicer
 // Public members.
 public:
     Servicer(); /**< Default constructor */
+    Servicer(unsigned int, std::shared_ptr< IndexedMinHeap< unsigned int > >); /**< Parameterized constructor */
     Servicer(const Servicer&); /**< Copy constructor */
     ~Servicer(); /**< Destructor */
 
-    void service_customer(unsigned int, std::shared_ptr< Customer >); /**< Services customer at current time and updates availability */
+    void service_customer(unsigned int, CustomerTable&, CustomerId, CompletionSink&); /**< Services customer at current time, records it, releases its row, and updates availability */
+    void service_customer(unsigned int, CustomerTable&, CustomerId); /**< Services customer at current time and updates availability, keeping its row */
     bool available(unsigned int) const;  /**< Returns availability state of servicer at given time */
     unsigned int total_idle_time() const; /**< Returns current total idle time for servicer */
     unsigned int unavailable_until() const; /**< Returns the time when the servicer will become available */
 
 // Private members.
 private:
+    unsigned int id_; /**< Index of servicer in the departure calendar */
+    std::shared_ptr< IndexedMinHeap< unsigned int > > departure_calendar_; /**< Departure calendar shared by servicers, keyed on unavailable_until_ */
     unsigned int unavailable_until_;  /**< Servicer availability state */
     unsigned int total_idle_time_; /**< Total time that servicer has been idle */
 
@@ -0,0 +1,321 @@
+/**
+ *
+ * @file SimulationReport.cpp
+ *
+ * @brief Results of one finished simulation run
+ *
+ * @author Josh Wiley
+ *
+ * @details Implements the SimulationReport class. A report is built once
+ *          from the simulation's accumulators when run() finishes and holds
+ *          only plain values, so it is cheap to move, safe to keep after the
+ *          simulation is gone, and never recomputes anything when read.
+ *
+ */
+//
+//  Preprocessor Directives  ///////////////////////////////////////////////////
+//
+#ifndef SIMULATION_REPORT_CPP_
+#define SIMULATION_REPORT_CPP_
+//
+//  Header Files  //////////////////////////////////////////////////////////////
+//
+#include <utility>
+#include "SimulationReport.h"
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Captures a finished run's results, reading the percentiles out of
+ *          the completion histograms
+ *
+ * @param[in] cpu_time
+ *            Milliseconds the run took
+ *
+ * @param[in] sim_time
+ *            Simulation time units the run covered
+ *
+ * @param[in] completions
+ *            Wait and sojourn statistics of the served customers
+ *
+ * @param[in] average_line_length
+ *            Time-averaged line length, averaged over the lines
+ *
+ * @param[in] max_line_length
+ *            Longest any line has been
+ *
+ * @param[in] average_customers_waiting
+ *            Time-averaged number of customers waiting in all lines
+ *
+ * @param[in] line_lengths
+ *            Time-averaged length of each line
+ *
+ * @param[in] servicer_idle_times
+ *            Total idle time of each servicer
+ *
+ * @param[in] arena_allocations
+ *            Number of allocations drawn from the simulation's arena
+ *
+ * @param[in] arena_bytes
+ *            Number of bytes drawn from the simulation's arena
+ *
+ */
+SimulationReport::SimulationReport(
+    unsigned int cpu_time,
+    unsigned int sim_time,
+    const CompletionSink& completions,
+    float average_line_length,
+    unsigned int max_line_length,
+    float average_customers_waiting,
+    std::vector< float > line_lengths,
+    std::vector< unsigned int > servicer_idle_times,
+    size_t arena_allocations,
+    size_t arena_bytes
+)
+    : cpu_time_(cpu_time), sim_time_(sim_time),
+      waits_(completions.waits()), sojourns_(completions.sojourns()),
+      wait_percentiles_(percentiles_of(completions.wait_histogram())),
+      sojourn_percentiles_(percentiles_of(completions.sojourn_histogram())),
+      average_line_length_(average_line_length), max_line_length_(max_line_length),
+      average_customers_waiting_(average_customers_waiting),
+      line_lengths_(std::move(line_lengths)), servicer_idle_times_(std::move(servicer_idle_times)),
+      arena_allocations_(arena_allocations), arena_bytes_(arena_bytes) {}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Destructor
+ *
+ */
+SimulationReport::~SimulationReport() {}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Returns number of milliseconds the simulation took to run
+ *
+ * @return Milliseconds of CPU (wall-clock) time
+ *
+ */
+unsigned int SimulationReport::cpu_time() const
+{
+    // Return.
+    return cpu_time_;
+}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Returns simulation (virtual) time covered by the run
+ *
+ * @return Elapsed simulation time
+ *
+ */
+unsigned int SimulationReport::sim_time() const
+{
+    // Return.
+    return sim_time_;
+}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Returns summary of customer wait times (count, extrema, mean,
+ *          variance)
+ *
+ * @return Summary of wait times
+ *
+ */
+const RunningStatistics& SimulationReport::waits() const
+{
+    // Return.
+    return waits_;
+}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Returns summary of customer times in system (count, extrema,
+ *          mean, variance)
+ *
+ * @return Summary of times in system
+ *
+ */
+const RunningStatistics& SimulationReport::sojourns() const
+{
+    // Return.
+    return sojourns_;
+}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Returns percentiles of customer wait time (within 1%, never
+ *          under)
+ *
+ * @return Wait time percentiles
+ *
+ */
+const SimulationReport::Percentiles& SimulationReport::wait_percentiles() const
+{
+    // Return.
+    return wait_percentiles_;
+}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Returns percentiles of customer time in system (within 1%, never
+ *          under)
+ *
+ * @return Time in system percentiles
+ *
+ */
+const SimulationReport::Percentiles& SimulationReport::sojourn_percentiles() const
+{
+    // Return.
+    return sojourn_percentiles_;
+}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Returns time-averaged line length, averaged over the lines
+ *
+ * @return Average line length
+ *
+ */
+float SimulationReport::average_line_length() const
+{
+    // Return.
+    return average_line_length_;
+}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Returns the longest any line has been
+ *
+ * @return Max line length
+ *
+ */
+unsigned int SimulationReport::max_line_length() const
+{
+    // Return.
+    return max_line_length_;
+}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Returns time-averaged number of customers waiting in all lines
+ *
+ * @return Average number of customers waiting
+ *
+ */
+float SimulationReport::average_customers_waiting() const
+{
+    // Return.
+    return average_customers_waiting_;
+}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Returns time-averaged length of each line
+ *
+ * @return Average lengths, in the order the lines were added
+ *
+ */
+const std::vector< float >& SimulationReport::line_lengths() const
+{
+    // Return.
+    return line_lengths_;
+}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Returns total idle time of each servicer
+ *
+ * @return Idle times, by servicer
+ *
+ */
+const std::vector< unsigned int >& SimulationReport::servicer_idle_times() const
+{
+    // Return.
+    return servicer_idle_times_;
+}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Returns number of allocations the simulation drew from its arena
+ *
+ * @return Number of arena allocations
+ *
+ */
+size_t SimulationReport::arena_allocations() const
+{
+    // Return.
+    return arena_allocations_;
+}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Returns number of bytes the simulation drew from its arena
+ *
+ * @return Number of arena bytes
+ *
+ */
+size_t SimulationReport::arena_bytes() const
+{
+    // Return.
+    return arena_bytes_;
+}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Reads the reported percentiles from a histogram
+ *
+ * @param[in] histogram
+ *            Histogram of times
+ *
+ * @return Median, 90th, 99th, and 99.9th percentiles
+ *
+ */
+SimulationReport::Percentiles SimulationReport::percentiles_of(const HdrHistogram& histogram)
+{
+    // Percentiles.
+    auto percentiles = Percentiles();
+    percentiles.p50 = histogram.value_at_percentile(50.0);
+    percentiles.p90 = histogram.value_at_percentile(90.0);
+    percentiles.p99 = histogram.value_at_percentile(99.0);
+    percentiles.p999 = histogram.value_at_percentile(99.9);
+
+    // Return.
+    return percentiles;
+}
+//
+//  Terminating Precompiler Directives  ////////////////////////////////////////
+//
+#endif // SIMULATION_REPORT_CPP_
+//
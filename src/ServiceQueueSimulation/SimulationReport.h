@@ -0,0 +1,96 @@
+/**
+ *
+ * @file SimulationReport.h
+ *
+ * @brief Results of one finished simulation run
+ *
+ * @author Josh Wiley
+ *
+ * @details Defines the SimulationReport class
+ *
+ */
+//
+//  Preprocessor Directives  ///////////////////////////////////////////////////
+//
+#ifndef SIMULATION_REPORT_H_
+#define SIMULATION_REPORT_H_
+//
+//  Header Files  //////////////////////////////////////////////////////////////
+//
+#include <cstddef>
+#include <vector>
+#include "../Statistics/RunningStatistics.h"
+#include "CompletionSink.h"
+//
+//  Class Definition  //////////////////////////////////////////////////////////
+//
+class SimulationReport
+{
+
+// Public members.
+public:
+    struct Percentiles
+    {
+        unsigned int p50; /**< Median */
+        unsigned int p90; /**< 90th percentile */
+        unsigned int p99; /**< 99th percentile */
+        unsigned int p999; /**< 99.9th percentile */
+    }; /**< Tail of a distribution of times */
+
+    SimulationReport(
+        unsigned int cpu_time,
+        unsigned int sim_time,
+        const CompletionSink& completions,
+        float average_line_length,
+        unsigned int max_line_length,
+        float average_customers_waiting,
+        std::vector< float > line_lengths,
+        std::vector< unsigned int > servicer_idle_times,
+        size_t arena_allocations,
+        size_t arena_bytes
+    ); /**< Parameterized constructor */
+    SimulationReport(const SimulationReport&) = default; /**< Copy constructor */
+    SimulationReport(SimulationReport&&) = default; /**< Move constructor */
+    ~SimulationReport(); /**< Destructor */
+
+    unsigned int cpu_time() const; /**< Milliseconds the run took */
+    unsigned int sim_time() const; /**< Simulation time units the run covered */
+    const RunningStatistics& waits() const; /**< Summary of customer wait times */
+    const RunningStatistics& sojourns() const; /**< Summary of customer times in system */
+    const Percentiles& wait_percentiles() const; /**< Percentiles of customer wait time */
+    const Percentiles& sojourn_percentiles() const; /**< Percentiles of customer time in system */
+    float average_line_length() const; /**< Time-averaged length of a line, averaged over the lines */
+    unsigned int max_line_length() const; /**< Maximum length of any line */
+    float average_customers_waiting() const; /**< Time-averaged number of customers waiting in all lines */
+    const std::vector< float >& line_lengths() const; /**< Time-averaged length of each line */
+    const std::vector< unsigned int >& servicer_idle_times() const; /**< Total idle time of each servicer */
+    size_t arena_allocations() const; /**< Number of allocations drawn from the simulation's arena */
+    size_t arena_bytes() const; /**< Number of bytes drawn from the simulation's arena */
+
+    SimulationReport& operator=(const SimulationReport&) = default; /**< Copy assignment operator */
+    SimulationReport& operator=(SimulationReport&&) = default; /**< Move assignment operator */
+
+// Private members.
+private:
+    static Percentiles percentiles_of(const HdrHistogram&); /**< Reads the reported percentiles from a histogram */
+
+    unsigned int cpu_time_; /**< Milliseconds the run took */
+    unsigned int sim_time_; /**< Simulation time units the run covered */
+    RunningStatistics waits_; /**< Summary of wait times */
+    RunningStatistics sojourns_; /**< Summary of times in system */
+    Percentiles wait_percentiles_; /**< Percentiles of wait time */
+    Percentiles sojourn_percentiles_; /**< Percentiles of time in system */
+    float average_line_length_; /**< Time-averaged line length */
+    unsigned int max_line_length_; /**< Maximum line length */
+    float average_customers_waiting_; /**< Time-averaged number waiting */
+    std::vector< float > line_lengths_; /**< Time-averaged length, by line */
+    std::vector< unsigned int > servicer_idle_times_; /**< Idle time, by servicer */
+    size_t arena_allocations_; /**< Arena allocation count */
+    size_t arena_bytes_; /**< Arena bytes allocated */
+
+};
+//
+//  Terminating Precompiler Directives  ////////////////////////////////////////
+//
+#endif // SIMULATION_REPORT_H_
+//
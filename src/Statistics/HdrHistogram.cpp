@@ -0,0 +1,410 @@
+/**
+ *
+ * @file HdrHistogram.cpp
+ *
+ * @brief Fixed-memory, log-bucketed histogram of non-negative integers with
+ *        bounded relative error, for percentiles
+ *
+ * @author Josh Wiley
+ *
+ * @details Implements the HdrHistogram class. With p precision bits, values
+ *          below 2^p get a bucket each; every power of two [2^k, 2^(k+1))
+ *          above that is split into 2^(p-1) equal buckets, found from the
+ *          value's leading bit and the p bits below it. A bucket is never
+ *          wider than 2^(1-p) of the values it holds, so any 32-bit value is
+ *          counted in a few thousand buckets with under 1% error (p = 8),
+ *          and two histograms of the same precision merge by adding counts.
+ *
+ */
+//
+//  Preprocessor Directives  ///////////////////////////////////////////////////
+//
+#ifndef HDR_HISTOGRAM_CPP_
+#define HDR_HISTOGRAM_CPP_
+#define VALUE_BITS (unsigned int) 32
+//
+//  Header Files  //////////////////////////////////////////////////////////////
+//
+#include <cmath>
+#include <algorithm>
+#include "HdrHistogram.h"
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Allocates every bucket up front, so recording never allocates
+ *
+ * @param[in] precision_bits
+ *            Bits of each value kept (clamped to [1, 16]); relative error is
+ *            at most 2^(1 - precision_bits)
+ *
+ */
+HdrHistogram::HdrHistogram(unsigned int precision_bits)
+    : precision_bits_(precision_bits < 1 ? 1 : precision_bits > 16 ? 16 : precision_bits),
+      count_(0), min_(0), max_(0)
+{
+    // Exact buckets, then half as many per remaining power of two.
+    auto exact = (size_t) 1 << precision_bits_;
+    auto per_power = exact / 2;
+
+    // Allocate.
+    counts_.assign(exact + (VALUE_BITS - precision_bits_) * per_power, 0);
+}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Copy-initializes histogram from another histogram
+ *
+ * @param[in] origin
+ *            Origin object from which the new object is to be instantiated with
+ *
+ */
+HdrHistogram::HdrHistogram(const HdrHistogram& origin)
+    : precision_bits_(origin.precision_bits_), counts_(origin.counts_), count_(origin.count_),
+      min_(origin.min_), max_(origin.max_) {}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Destructor
+ *
+ */
+HdrHistogram::~HdrHistogram() {}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Adds to the count of the value's bucket and to the exact extrema
+ *
+ * @param[in] value
+ *            Value to record
+ *
+ * @param[in] count
+ *            Number of times to record it
+ *
+ */
+void HdrHistogram::record(unsigned int value, std::uint64_t count)
+{
+    // Nothing to record?
+    if (count == 0)
+    {
+        // Return.
+        return;
+    }
+
+    // Extrema.
+    if (count_ == 0 || value < min_)
+    {
+        // New min.
+        min_ = value;
+    }
+    if (count_ == 0 || value > max_)
+    {
+        // New max.
+        max_ = value;
+    }
+
+    // Count.
+    counts_[index_of(value)] += count;
+    count_ += count;
+}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Counts each value of a range, tracking extrema in registers and
+ *          storing them once (for binning whole columns)
+ *
+ * @param[in] first
+ *            Pointer to the first value
+ *
+ * @param[in] last
+ *            Pointer past the last value
+ *
+ */
+void HdrHistogram::record_range(const unsigned int* first, const unsigned int* last)
+{
+    // Nothing to record?
+    if (first == last)
+    {
+        // Return.
+        return;
+    }
+
+    // Running extrema.
+    auto min = count_ == 0 ? *first : std::min(min_, *first);
+    auto max = count_ == 0 ? *first : std::max(max_, *first);
+    count_ += (std::uint64_t) (last - first);
+
+    // Each value.
+    for (; first != last; ++first)
+    {
+        // Count.
+        min = std::min(min, *first);
+        max = std::max(max, *first);
+        counts_[index_of(*first)]++;
+    }
+
+    // Store extrema.
+    min_ = min;
+    max_ = max;
+}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Adds another histogram's bucket counts and extrema to this one,
+ *          giving the histogram of both sets of values (so per-thread or
+ *          per-replication histograms can be combined)
+ *
+ * @param[in] other
+ *            Histogram to fold in
+ *
+ * @return Boolean value indicating whether the histograms had the same
+ *         precision (nothing is merged if not)
+ *
+ */
+bool HdrHistogram::merge(const HdrHistogram& other)
+{
+    // Different buckets?
+    if (other.precision_bits_ != precision_bits_)
+    {
+        // Failure.
+        return false;
+    }
+
+    // Nothing to add?
+    if (other.count_ == 0)
+    {
+        // Success.
+        return true;
+    }
+
+    // Extrema.
+    if (count_ == 0 || other.min_ < min_)
+    {
+        // New min.
+        min_ = other.min_;
+    }
+    if (count_ == 0 || other.max_ > max_)
+    {
+        // New max.
+        max_ = other.max_;
+    }
+
+    // Add counts.
+    for (auto i = (size_t) 0; i < counts_.size(); i++)
+    {
+        // Add.
+        counts_[i] += other.counts_[i];
+    }
+    count_ += other.count_;
+
+    // Success.
+    return true;
+}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Returns number of values recorded
+ *
+ * @return Number of values recorded
+ *
+ */
+std::uint64_t HdrHistogram::count() const
+{
+    // Return count.
+    return count_;
+}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Returns smallest value recorded
+ *
+ * @return Smallest value recorded (0 if none)
+ *
+ */
+unsigned int HdrHistogram::min() const
+{
+    // Return min.
+    return min_;
+}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Returns largest value recorded
+ *
+ * @return Largest value recorded (0 if none)
+ *
+ */
+unsigned int HdrHistogram::max() const
+{
+    // Return max.
+    return max_;
+}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Finds the bucket holding the ceil(percentile% of count)-th
+ *          smallest value and returns the largest value that bucket holds
+ *          (capped at the exact max), so a percentile is never understated
+ *          and is over by less than the bucket width
+ *
+ * @param[in] percentile
+ *            Percentage of values, in [0, 100]
+ *
+ * @return Value at the percentile (0 if nothing was recorded)
+ *
+ */
+unsigned int HdrHistogram::value_at_percentile(double percentile) const
+{
+    // Nothing recorded?
+    if (count_ == 0)
+    {
+        // Return.
+        return 0;
+    }
+
+    // Rank of the value (1-based).
+    auto rank = (std::uint64_t) std::ceil(percentile / 100.0 * count_);
+    rank = rank < 1 ? 1 : rank > count_ ? count_ : rank;
+
+    // Walk buckets.
+    auto seen = (std::uint64_t) 0;
+    for (auto i = (size_t) 0; i < counts_.size(); i++)
+    {
+        // Add bucket.
+        seen += counts_[i];
+
+        // Reached rank?
+        if (seen >= rank)
+        {
+            // Return (exact at the ends).
+            return rank == 1 ? min_ : std::min(highest_in(i), max_);
+        }
+    }
+
+    // Return max.
+    return max_;
+}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Returns number of buckets
+ *
+ * @return Number of buckets
+ *
+ */
+size_t HdrHistogram::bucket_count() const
+{
+    // Return buckets.
+    return counts_.size();
+}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Assigns a copy of another histogram
+ *
+ * @param[in] rhs
+ *            Histogram to copy
+ *
+ * @return Reference to this histogram
+ *
+ */
+HdrHistogram& HdrHistogram::operator=(const HdrHistogram& rhs)
+{
+    // Copy.
+    precision_bits_ = rhs.precision_bits_;
+    counts_ = rhs.counts_;
+    count_ = rhs.count_;
+    min_ = rhs.min_;
+    max_ = rhs.max_;
+
+    // Return.
+    return *this;
+}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Returns the bucket of a value: the value itself below 2^p, else
+ *          the value's power of two and the p - 1 bits after its leading bit
+ *
+ * @param[in] value
+ *            Value to place
+ *
+ * @return Index of the bucket holding the value
+ *
+ */
+size_t HdrHistogram::index_of(unsigned int value) const
+{
+    // Exact?
+    auto exact = (size_t) 1 << precision_bits_;
+    if (value < exact)
+    {
+        // Own bucket.
+        return value;
+    }
+
+    // Bits dropped, and the leading p bits (in [2^(p-1), 2^p)).
+    auto shift = (size_t) (VALUE_BITS - __builtin_clz(value)) - precision_bits_;
+    auto leading = (size_t) (value >> shift);
+
+    // Return index.
+    return exact + (shift - 1) * (exact / 2) + (leading - exact / 2);
+}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Returns the largest value that maps to a bucket
+ *
+ * @param[in] index
+ *            Index of the bucket
+ *
+ * @return Largest value the bucket holds
+ *
+ */
+unsigned int HdrHistogram::highest_in(size_t index) const
+{
+    // Exact?
+    auto exact = (size_t) 1 << precision_bits_;
+    if (index < exact)
+    {
+        // Own value.
+        return (unsigned int) index;
+    }
+
+    // Bits dropped, and the leading p bits.
+    auto shift = (index - exact) / (exact / 2) + 1;
+    auto leading = (index - exact) % (exact / 2) + exact / 2;
+
+    // Return last value with those leading bits.
+    return (unsigned int) (((std::uint64_t) (leading + 1) << shift) - 1);
+}
+//
+//  Terminating Precompiler Directives  ////////////////////////////////////////
+//
+#endif // HDR_HISTOGRAM_CPP_
+//
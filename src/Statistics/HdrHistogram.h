@@ -0,0 +1,64 @@
+/**
+ *
+ * @file HdrHistogram.h
+ *
+ * @brief Fixed-memory, log-bucketed histogram of non-negative integers with
+ *        bounded relative error, for percentiles
+ *
+ * @author Josh Wiley
+ *
+ * @details Defines the HdrHistogram class
+ *
+ */
+//
+//  Preprocessor Directives  ///////////////////////////////////////////////////
+//
+#ifndef HDR_HISTOGRAM_H_
+#define HDR_HISTOGRAM_H_
+//
+//  Header Files  //////////////////////////////////////////////////////////////
+//
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+//
+//  Class Definition  //////////////////////////////////////////////////////////
+//
+class HdrHistogram
+{
+
+// Public members.
+public:
+    HdrHistogram(unsigned int precision_bits = 8); /**< Parameterized constructor */
+    HdrHistogram(const HdrHistogram&); /**< Copy constructor */
+    ~HdrHistogram(); /**< Destructor */
+
+    void record(unsigned int, std::uint64_t count = 1); /**< Counts a value (count times) */
+    void record_range(const unsigned int*, const unsigned int*); /**< Counts each value of a contiguous range */
+    bool merge(const HdrHistogram&); /**< Adds another histogram's counts, returns boolean indicating success (precisions must match) */
+
+    std::uint64_t count() const; /**< Returns number of values recorded */
+    unsigned int min() const; /**< Returns smallest value recorded (exact, 0 if none) */
+    unsigned int max() const; /**< Returns largest value recorded (exact, 0 if none) */
+    unsigned int value_at_percentile(double) const; /**< Returns the value at or below which the given percentage of values fall */
+    size_t bucket_count() const; /**< Returns number of buckets (fixed by the precision) */
+
+    HdrHistogram& operator=(const HdrHistogram&); /**< Assignment operator */
+
+// Private members.
+private:
+    size_t index_of(unsigned int) const; /**< Returns bucket holding a value */
+    unsigned int highest_in(size_t) const; /**< Returns largest value a bucket holds */
+
+    unsigned int precision_bits_; /**< Values below 2^precision_bits_ are counted exactly; above, each power of two is split into 2^(precision_bits_ - 1) buckets */
+    std::vector< std::uint64_t > counts_; /**< Count per bucket */
+    std::uint64_t count_; /**< Number of values recorded */
+    unsigned int min_; /**< Smallest value recorded */
+    unsigned int max_; /**< Largest value recorded */
+
+};
+//
+//  Terminating Precompiler Directives  ////////////////////////////////////////
+//
+#endif // HDR_HISTOGRAM_H_
+//
@@ -0,0 +1,366 @@
+/**
+ *
+ * @file RunningStatistics.cpp
+ *
+ * @brief Constant-memory summary of a stream of observations
+ *
+ * @author Josh Wiley
+ *
+ * @details Implements the RunningStatistics class. Variance uses Welford's
+ *          update, which stays accurate where the textbook sum of squares
+ *          cancels catastrophically, and merge() uses the pairwise form of
+ *          the same update so partial summaries can be combined.
+ *
+ */
+//
+//  Preprocessor Directives  ///////////////////////////////////////////////////
+//
+#ifndef RUNNING_STATISTICS_CPP_
+#define RUNNING_STATISTICS_CPP_
+#define T_TABLE_SIZE (std::uint64_t) 30
+#define Z_975 (double) 1.959963984540054
+//
+//  Header Files  //////////////////////////////////////////////////////////////
+//
+#include <cmath>
+#include "RunningStatistics.h"
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Default constructor (no observations)
+ *
+ */
+RunningStatistics::RunningStatistics()
+    : count_(0), sum_(0.0), min_(0.0), max_(0.0), mean_(0.0), m2_(0.0) {}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Creates the summary of observations whose moments were computed
+ *          elsewhere (such as by a vectorized pass over a column), so it can
+ *          be merged with other summaries
+ *
+ * @param[in] count
+ *            Number of observations
+ *
+ * @param[in] sum
+ *            Sum of observations
+ *
+ * @param[in] min
+ *            Smallest observation
+ *
+ * @param[in] max
+ *            Largest observation
+ *
+ * @param[in] m2
+ *            Sum of squared deviations from the mean (sum / count)
+ *
+ */
+RunningStatistics::RunningStatistics(std::uint64_t count, double sum, double min, double max, double m2)
+    : count_(count), sum_(sum), min_(count == 0 ? 0.0 : min), max_(count == 0 ? 0.0 : max),
+      mean_(count == 0 ? 0.0 : sum / count), m2_(count == 0 ? 0.0 : m2) {}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Copy-initializes summary from another summary
+ *
+ * @param[in] origin
+ *            Origin object from which the new object is to be instantiated with
+ *
+ */
+RunningStatistics::RunningStatistics(const RunningStatistics& origin)
+    : count_(origin.count_), sum_(origin.sum_), min_(origin.min_), max_(origin.max_),
+      mean_(origin.mean_), m2_(origin.m2_) {}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Destructor
+ *
+ */
+RunningStatistics::~RunningStatistics() {}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Folds an observation into the count, sum, extrema, and Welford
+ *          mean and squared deviation
+ *
+ * @param[in] value
+ *            Observation
+ *
+ */
+void RunningStatistics::add(double value)
+{
+    // Count.
+    count_++;
+
+    // Sum.
+    sum_ += value;
+
+    // Extrema.
+    if (count_ == 1 || value < min_)
+    {
+        // New min.
+        min_ = value;
+    }
+    if (count_ == 1 || value > max_)
+    {
+        // New max.
+        max_ = value;
+    }
+
+    // Welford update.
+    auto delta = value - mean_;
+    mean_ += delta / count_;
+    m2_ += delta * (value - mean_);
+}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Combines another summary into this one (Chan et al.'s pairwise
+ *          update), giving the summary of both sets of observations
+ *
+ * @param[in] other
+ *            Summary to fold in
+ *
+ */
+void RunningStatistics::merge(const RunningStatistics& other)
+{
+    // Nothing to add?
+    if (other.count_ == 0)
+    {
+        // Return.
+        return;
+    }
+
+    // Nothing here?
+    if (count_ == 0)
+    {
+        // Take other.
+        *this = other;
+
+        // Return.
+        return;
+    }
+
+    // Combined count and mean shift.
+    auto count = count_ + other.count_;
+    auto delta = other.mean_ - mean_;
+
+    // Moments.
+    m2_ += other.m2_ + delta * delta * ((double) count_ * other.count_ / count);
+    mean_ += delta * other.count_ / count;
+
+    // Count and sum.
+    count_ = count;
+    sum_ += other.sum_;
+
+    // Extrema.
+    if (other.min_ < min_)
+    {
+        // New min.
+        min_ = other.min_;
+    }
+    if (other.max_ > max_)
+    {
+        // New max.
+        max_ = other.max_;
+    }
+}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Returns number of observations
+ *
+ * @return Number of observations
+ *
+ */
+std::uint64_t RunningStatistics::count() const
+{
+    // Return count.
+    return count_;
+}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Returns sum of observations
+ *
+ * @return Sum of observations
+ *
+ */
+double RunningStatistics::sum() const
+{
+    // Return sum.
+    return sum_;
+}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Returns smallest observation
+ *
+ * @return Smallest observation (0 if none)
+ *
+ */
+double RunningStatistics::min() const
+{
+    // Return min.
+    return min_;
+}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Returns largest observation
+ *
+ * @return Largest observation (0 if none)
+ *
+ */
+double RunningStatistics::max() const
+{
+    // Return max.
+    return max_;
+}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Returns mean of observations, taken from the sum (exact for the
+ *          integral times the simulation records) rather than the Welford mean
+ *
+ * @return Mean of observations (0 if none)
+ *
+ */
+double RunningStatistics::mean() const
+{
+    // Return mean.
+    return count_ == 0 ? 0.0 : sum_ / count_;
+}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Returns sample variance of observations
+ *
+ * @return Sample variance of observations (0 if fewer than two)
+ *
+ */
+double RunningStatistics::variance() const
+{
+    // Return variance.
+    return count_ < 2 ? 0.0 : m2_ / (count_ - 1);
+}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Returns sample standard deviation of observations
+ *
+ * @return Sample standard deviation of observations (0 if fewer than two)
+ *
+ */
+double RunningStatistics::standard_deviation() const
+{
+    // Return deviation.
+    return std::sqrt(variance());
+}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Returns half-width of the 95% confidence interval of the mean,
+ *          t(0.975, n - 1) * s / sqrt(n), for independent observations such
+ *          as the results of independent replications. The t quantile is
+ *          tabulated up to 30 degrees of freedom and taken from its
+ *          Cornish-Fisher expansion about the normal quantile above that
+ *
+ * @return Half-width of the interval (0 if fewer than two observations)
+ *
+ */
+double RunningStatistics::confidence_half_width() const
+{
+    // t(0.975, df) for df = 1..30.
+    static const double t_table[T_TABLE_SIZE] = {
+        12.706, 4.303, 3.182, 2.776, 2.571, 2.447, 2.365, 2.306, 2.262, 2.228,
+        2.201, 2.179, 2.160, 2.145, 2.131, 2.120, 2.110, 2.101, 2.093, 2.086,
+        2.080, 2.074, 2.069, 2.064, 2.060, 2.056, 2.052, 2.048, 2.045, 2.042
+    };
+
+    // Not enough observations?
+    if (count_ < 2)
+    {
+        // No interval.
+        return 0.0;
+    }
+
+    // Quantile.
+    auto df = count_ - 1;
+    auto t = 0.0;
+    if (df <= T_TABLE_SIZE)
+    {
+        // Tabulated.
+        t = t_table[df - 1];
+    }
+    else
+    {
+        // Expansion.
+        auto z = Z_975;
+        auto z3 = z * z * z;
+        auto z5 = z3 * z * z;
+        t = z + (z3 + z) / (4.0 * df) + (5.0 * z5 + 16.0 * z3 + 3.0 * z) / (96.0 * df * df);
+    }
+
+    // Return.
+    return t * standard_deviation() / std::sqrt((double) count_);
+}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Assigns a copy of another summary
+ *
+ * @param[in] rhs
+ *            Summary to copy
+ *
+ * @return Reference to this summary
+ *
+ */
+RunningStatistics& RunningStatistics::operator=(const RunningStatistics& rhs)
+{
+    // Copy.
+    count_ = rhs.count_;
+    sum_ = rhs.sum_;
+    min_ = rhs.min_;
+    max_ = rhs.max_;
+    mean_ = rhs.mean_;
+    m2_ = rhs.m2_;
+
+    // Return.
+    return *this;
+}
+//
+//  Terminating Precompiler Directives  ////////////////////////////////////////
+//
+#endif // RUNNING_STATISTICS_CPP_
+//
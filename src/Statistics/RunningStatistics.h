@@ -0,0 +1,62 @@
+/**
+ *
+ * @file RunningStatistics.h
+ *
+ * @brief Constant-memory summary of a stream of observations
+ *
+ * @author Josh Wiley
+ *
+ * @details Defines the RunningStatistics class
+ *
+ */
+//
+//  Preprocessor Directives  ///////////////////////////////////////////////////
+//
+#ifndef RUNNING_STATISTICS_H_
+#define RUNNING_STATISTICS_H_
+//
+//  Header Files  //////////////////////////////////////////////////////////////
+//
+#include <cstdint>
+//
+//  Class Definition  //////////////////////////////////////////////////////////
+//
+class RunningStatistics
+{
+
+// Public members.
+public:
+    RunningStatistics(); /**< Default constructor */
+    RunningStatistics(std::uint64_t, double, double, double, double); /**< Parameterized constructor (from precomputed moments) */
+    RunningStatistics(const RunningStatistics&); /**< Copy constructor */
+    ~RunningStatistics(); /**< Destructor */
+
+    void add(double); /**< Folds an observation into the summary */
+    void merge(const RunningStatistics&); /**< Folds another summary into this one, as if its observations had been added */
+
+    std::uint64_t count() const; /**< Returns number of observations */
+    double sum() const; /**< Returns sum of observations */
+    double min() const; /**< Returns smallest observation (0 if none) */
+    double max() const; /**< Returns largest observation (0 if none) */
+    double mean() const; /**< Returns mean of observations (0 if none) */
+    double variance() const; /**< Returns sample variance of observations (0 if fewer than two) */
+    double standard_deviation() const; /**< Returns sample standard deviation of observations */
+    double confidence_half_width() const; /**< Returns half-width of the 95% Student-t confidence interval of the mean (0 if fewer than two) */
+
+    RunningStatistics& operator=(const RunningStatistics&); /**< Assignment operator */
+
+// Private members.
+private:
+    std::uint64_t count_; /**< Number of observations */
+    double sum_; /**< Sum of observations */
+    double min_; /**< Smallest observation */
+    double max_; /**< Largest observation */
+    double mean_; /**< Running mean (Welford) */
+    double m2_; /**< Sum of squared deviations from the running mean (Welford) */
+
+};
+//
+//  Terminating Precompiler Directives  ////////////////////////////////////////
+//
+#endif // RUNNING_STATISTICS_H_
+//
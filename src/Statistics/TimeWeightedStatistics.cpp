@@ -0,0 +1,277 @@
+/**
+ *
+ * @file TimeWeightedStatistics.cpp
+ *
+ * @brief Constant-memory summary of a piecewise-constant level over time,
+ *        such as the length of a line
+ *
+ * @author Josh Wiley
+ *
+ * @details Implements the TimeWeightedStatistics class. Each update closes
+ *          the interval the previous level held for and adds level * width
+ *          (and level^2 * width) to integer running areas, so the time
+ *          average is exact and costs O(1) per change.
+ *
+ */
+//
+//  Preprocessor Directives  ///////////////////////////////////////////////////
+//
+#ifndef TIME_WEIGHTED_STATISTICS_CPP_
+#define TIME_WEIGHTED_STATISTICS_CPP_
+//
+//  Header Files  //////////////////////////////////////////////////////////////
+//
+#include "TimeWeightedStatistics.h"
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Starts the summary at a level and time
+ *
+ * @param[in] start_time
+ *            Time the summary starts at
+ *
+ * @param[in] level
+ *            Level at the start time
+ *
+ */
+TimeWeightedStatistics::TimeWeightedStatistics(unsigned int start_time, size_t level)
+    : start_time_(start_time), last_time_(start_time), level_(level), min_(level), max_(level),
+      changes_(0), area_(0), square_area_(0) {}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Copy-initializes summary from another summary
+ *
+ * @param[in] origin
+ *            Origin object from which the new object is to be instantiated with
+ *
+ */
+TimeWeightedStatistics::TimeWeightedStatistics(const TimeWeightedStatistics& origin)
+    : start_time_(origin.start_time_), last_time_(origin.last_time_), level_(origin.level_),
+      min_(origin.min_), max_(origin.max_), changes_(origin.changes_), area_(origin.area_),
+      square_area_(origin.square_area_) {}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Destructor
+ *
+ */
+TimeWeightedStatistics::~TimeWeightedStatistics() {}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Closes the interval held by the current level and starts a new
+ *          one; several updates at the same time only keep the last level
+ *          in the areas, but every one counts toward the extrema
+ *
+ * @param[in] time
+ *            Time of the change (not before the last change)
+ *
+ * @param[in] level
+ *            Level from the given time on
+ *
+ */
+void TimeWeightedStatistics::update(unsigned int time, size_t level)
+{
+    // Width of the closed interval.
+    auto width = (std::uint64_t) (time - last_time_);
+
+    // Add areas.
+    area_ += level_ * width;
+    square_area_ += (std::uint64_t) level_ * level_ * width;
+
+    // Start new interval.
+    last_time_ = time;
+    level_ = level;
+    changes_++;
+
+    // Extrema.
+    if (level < min_)
+    {
+        // New min.
+        min_ = level;
+    }
+    if (level > max_)
+    {
+        // New max.
+        max_ = level;
+    }
+}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Returns the current level
+ *
+ * @return Level since the last change
+ *
+ */
+size_t TimeWeightedStatistics::level() const
+{
+    // Return level.
+    return level_;
+}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Returns lowest level reached
+ *
+ * @return Lowest level reached
+ *
+ */
+size_t TimeWeightedStatistics::min() const
+{
+    // Return min.
+    return min_;
+}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Returns highest level reached
+ *
+ * @return Highest level reached
+ *
+ */
+size_t TimeWeightedStatistics::max() const
+{
+    // Return max.
+    return max_;
+}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Returns number of updates
+ *
+ * @return Number of updates
+ *
+ */
+std::uint64_t TimeWeightedStatistics::changes() const
+{
+    // Return changes.
+    return changes_;
+}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Returns the integral of the level, with the current level held
+ *          up to the given time
+ *
+ * @param[in] until
+ *            End of the integral (not before the last change)
+ *
+ * @return Area under the level from the start time to the given time
+ *
+ */
+std::uint64_t TimeWeightedStatistics::area(unsigned int until) const
+{
+    // Return area.
+    return area_ + level_ * (std::uint64_t) (until - last_time_);
+}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Returns the time-averaged level
+ *
+ * @param[in] until
+ *            End of the averaging window (not before the last change)
+ *
+ * @return Area divided by the time elapsed (the current level if no time
+ *         has elapsed)
+ *
+ */
+double TimeWeightedStatistics::mean(unsigned int until) const
+{
+    // No time elapsed?
+    if (until == start_time_)
+    {
+        // Return level.
+        return (double) level_;
+    }
+
+    // Return mean.
+    return (double) area(until) / (until - start_time_);
+}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Returns the time-weighted variance of the level
+ *
+ * @param[in] until
+ *            End of the averaging window (not before the last change)
+ *
+ * @return Time average of the squared level less the squared time average
+ *         (0 if no time has elapsed)
+ *
+ */
+double TimeWeightedStatistics::variance(unsigned int until) const
+{
+    // No time elapsed?
+    if (until == start_time_)
+    {
+        // Return.
+        return 0.0;
+    }
+
+    // Time averages of the level and its square.
+    auto duration = (double) (until - start_time_);
+    auto square_area = square_area_ + (std::uint64_t) level_ * level_ * (until - last_time_);
+    auto mean_level = area(until) / duration;
+    auto variance = square_area / duration - mean_level * mean_level;
+
+    // Return (clamped against rounding).
+    return variance > 0.0 ? variance : 0.0;
+}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Assigns a copy of another summary
+ *
+ * @param[in] rhs
+ *            Summary to copy
+ *
+ * @return Reference to this summary
+ *
+ */
+TimeWeightedStatistics& TimeWeightedStatistics::operator=(const TimeWeightedStatistics& rhs)
+{
+    // Copy.
+    start_time_ = rhs.start_time_;
+    last_time_ = rhs.last_time_;
+    level_ = rhs.level_;
+    min_ = rhs.min_;
+    max_ = rhs.max_;
+    changes_ = rhs.changes_;
+    area_ = rhs.area_;
+    square_area_ = rhs.square_area_;
+
+    // Return.
+    return *this;
+}
+//
+//  Terminating Precompiler Directives  ////////////////////////////////////////
+//
+#endif // TIME_WEIGHTED_STATISTICS_CPP_
+//
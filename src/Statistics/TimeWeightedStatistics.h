@@ -0,0 +1,63 @@
+/**
+ *
+ * @file TimeWeightedStatistics.h
+ *
+ * @brief Constant-memory summary of a piecewise-constant level over time,
+ *        such as the length of a line
+ *
+ * @author Josh Wiley
+ *
+ * @details Defines the TimeWeightedStatistics class
+ *
+ */
+//
+//  Preprocessor Directives  ///////////////////////////////////////////////////
+//
+#ifndef TIME_WEIGHTED_STATISTICS_H_
+#define TIME_WEIGHTED_STATISTICS_H_
+//
+//  Header Files  //////////////////////////////////////////////////////////////
+//
+#include <cstddef>
+#include <cstdint>
+//
+//  Class Definition  //////////////////////////////////////////////////////////
+//
+class TimeWeightedStatistics
+{
+
+// Public members.
+public:
+    TimeWeightedStatistics(unsigned int start_time = 0, size_t level = 0); /**< Parameterized constructor */
+    TimeWeightedStatistics(const TimeWeightedStatistics&); /**< Copy constructor */
+    ~TimeWeightedStatistics(); /**< Destructor */
+
+    void update(unsigned int, size_t); /**< Changes the level at the given time (not before the last change) */
+
+    size_t level() const; /**< Returns the current level */
+    size_t min() const; /**< Returns lowest level reached */
+    size_t max() const; /**< Returns highest level reached */
+    std::uint64_t changes() const; /**< Returns number of updates */
+    std::uint64_t area(unsigned int) const; /**< Returns area under the level from the start time to the given time */
+    double mean(unsigned int) const; /**< Returns time-averaged level from the start time to the given time */
+    double variance(unsigned int) const; /**< Returns time-weighted variance of the level from the start time to the given time */
+
+    TimeWeightedStatistics& operator=(const TimeWeightedStatistics&); /**< Assignment operator */
+
+// Private members.
+private:
+    unsigned int start_time_; /**< Time the summary starts at */
+    unsigned int last_time_; /**< Time of the last change */
+    size_t level_; /**< Level since the last change */
+    size_t min_; /**< Lowest level */
+    size_t max_; /**< Highest level */
+    std::uint64_t changes_; /**< Number of updates */
+    std::uint64_t area_; /**< Integral of the level up to the last change (exact) */
+    std::uint64_t square_area_; /**< Integral of the squared level up to the last change (exact) */
+
+};
+//
+//  Terminating Precompiler Directives  ////////////////////////////////////////
+//
+#endif // TIME_WEIGHTED_STATISTICS_H_
+//
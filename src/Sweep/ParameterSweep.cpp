@@ -0,0 +1,367 @@
+/**
+ *
+ * @file ParameterSweep.cpp
+ *
+ * @brief Runs a simulation at every point of a grid of teller counts, lane
+ *        counts, lane types, and loads
+ *
+ * @author Josh Wiley
+ *
+ * @details Implements the ParameterSweep class. Each load level's arrival
+ *          trace is generated once, from its own random stream, into a
+ *          read-only vector that every point at that load replays through a
+ *          TraceArrivalSource; points differing only in tellers or lanes
+ *          therefore see exactly the same customers. Points are spread over
+ *          the pool and their reports kept by index, so the CSV is the same
+ *          for any number of threads.
+ *
+ */
+//
+//  Preprocessor Directives  ///////////////////////////////////////////////////
+//
+#ifndef PARAMETER_SWEEP_CPP_
+#define PARAMETER_SWEEP_CPP_
+#define INITIAL_LANE_CAPACITY (size_t) 64
+//
+//  Header Files  //////////////////////////////////////////////////////////////
+//
+#include "ParameterSweep.h"
+#include "../Queue/Queue.h"
+#include "../Queue/QueueArray.h"
+#include "../Queue/QueueChunkList.h"
+#include "../Queue/QueueIntrusive.h"
+#include "../Queue/QueueList.h"
+#include "../ArrivalSource/RandomArrivalSource.h"
+#include "../ArrivalSource/TraceArrivalSource.h"
+#include "../Replication/ReplicationRunner.h"
+#include "../ServiceQueueSimulation/ServiceQueueSimulation.h"
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Parameterized constructor
+ *
+ * @param[in] tellers
+ *            Teller counts
+ *
+ * @param[in] lanes
+ *            Lane counts
+ *
+ * @param[in] lane_types
+ *            Lane types
+ *
+ * @param[in] loads
+ *            Loads, as numbers of customers arriving over the arrival window
+ *
+ * @param[in] arrival_min
+ *            Start of the arrival window
+ *
+ * @param[in] arrival_max
+ *            End of the arrival window
+ *
+ * @param[in] transaction_min
+ *            Minimum transaction length
+ *
+ * @param[in] transaction_max
+ *            Maximum transaction length
+ *
+ * @param[in] seed
+ *            Seed the traces' random streams are derived from
+ *
+ */
+ParameterSweep::ParameterSweep(
+    std::vector< unsigned int > tellers,
+    std::vector< unsigned int > lanes,
+    std::vector< LaneType > lane_types,
+    std::vector< unsigned int > loads,
+    unsigned int arrival_min,
+    unsigned int arrival_max,
+    unsigned int transaction_min,
+    unsigned int transaction_max,
+    std::uint64_t seed
+)
+    : tellers_(tellers), lanes_(lanes), lane_types_(lane_types), loads_(loads),
+      arrival_min_(arrival_min), arrival_max_(arrival_max),
+      transaction_min_(transaction_min), transaction_max_(transaction_max), seed_(seed) {}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Destructor
+ *
+ */
+ParameterSweep::~ParameterSweep() {}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Returns number of points in the grid
+ *
+ * @return Product of the sizes of every axis
+ *
+ */
+size_t ParameterSweep::point_count() const
+{
+    // Return.
+    return tellers_.size() * lanes_.size() * lane_types_.size() * loads_.size();
+}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Returns the point at an index; tellers vary slowest, then lanes,
+ *          then lane types, and loads fastest
+ *
+ * @param[in] index
+ *            Index of the point, less than point_count()
+ *
+ * @return Point at the index
+ *
+ */
+ParameterSweep::Point ParameterSweep::point(size_t index) const
+{
+    // Point.
+    auto result = Point();
+
+    // Digits, fastest first.
+    result.load = loads_[index % loads_.size()];
+    index /= loads_.size();
+    result.lane_type = lane_types_[index % lane_types_.size()];
+    index /= lane_types_.size();
+    result.lanes = lanes_[index % lanes_.size()];
+    index /= lanes_.size();
+    result.tellers = tellers_[index];
+
+    // Return.
+    return result;
+}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Generates every load's trace across the pool, runs every point
+ *          across the pool, then writes the header and one row per point in
+ *          index order
+ *
+ * @param[in] pool
+ *            Threads traces and points run on
+ *
+ * @param[out] output
+ *             Stream receiving the CSV
+ *
+ */
+void ParameterSweep::run(ThreadPool& pool, std::ostream& output) const
+{
+    // Traces.
+    auto traces = std::vector< std::shared_ptr< const std::vector< Customer > > >(loads_.size());
+    pool.parallel_for(loads_.size(), [&] (size_t load) {
+        traces[load] = generate_trace(load);
+    });
+
+    // Points.
+    auto reports = std::vector< std::unique_ptr< SimulationReport > >(point_count());
+    pool.parallel_for(reports.size(), [&] (size_t index) {
+        reports[index].reset(new SimulationReport(run_point(point(index), traces[index % loads_.size()])));
+    });
+
+    // Rows (enough digits that large times are not written in exponent form).
+    auto precision = output.precision(12);
+    write_header(output);
+    for (auto index = (size_t) 0; index < reports.size(); index++)
+    {
+        // Write.
+        write_row(output, point(index), *reports[index]);
+    }
+    output.precision(precision);
+}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Returns the name of a lane type
+ *
+ * @param[in] lane_type
+ *            Lane type
+ *
+ * @return Name written to the CSV
+ *
+ */
+const char* ParameterSweep::lane_type_name(LaneType lane_type)
+{
+    // Name.
+    switch (lane_type)
+    {
+        case LaneType::array: return "array";
+        case LaneType::chunk_list: return "chunk_list";
+        case LaneType::intrusive: return "intrusive";
+        case LaneType::linked_list: return "linked_list";
+    }
+
+    // Unreachable.
+    return "unknown";
+}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Generates a load level's trace, sorted by arrival time, from
+ *          the load's own stream of the sweep seed
+ *
+ * @param[in] load
+ *            Index of the load level
+ *
+ * @return Read-only trace of the load's customers
+ *
+ */
+std::shared_ptr< const std::vector< Customer > > ParameterSweep::generate_trace(size_t load) const
+{
+    // Source.
+    auto source = RandomArrivalSource(
+        loads_[load],
+        arrival_min_,
+        arrival_max_,
+        transaction_min_,
+        transaction_max_,
+        ReplicationRunner::stream_seed(seed_, load)
+    );
+
+    // Collect.
+    auto trace_ptr = std::make_shared< std::vector< Customer > >();
+    trace_ptr->reserve(loads_[load]);
+    auto customer = Customer();
+    while (source.next(customer))
+    {
+        // Append.
+        trace_ptr->push_back(customer);
+    }
+
+    // Return.
+    return trace_ptr;
+}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Builds the point's lanes and runs a simulation over its load's
+ *          trace
+ *
+ * @param[in] point
+ *            Point to run
+ *
+ * @param[in] trace_ptr
+ *            Trace of the point's load level
+ *
+ * @return Report of the run
+ *
+ */
+SimulationReport ParameterSweep::run_point(const Point& point, std::shared_ptr< const std::vector< Customer > > trace_ptr) const
+{
+    // Lanes.
+    auto lanes = std::vector< std::shared_ptr< Queue< CustomerId > > >();
+    for (auto i = (unsigned int) 0; i < point.lanes; i++)
+    {
+        // Lane of the point's type.
+        switch (point.lane_type)
+        {
+            case LaneType::array:
+                lanes.push_back(std::make_shared< QueueArray< CustomerId > >(INITIAL_LANE_CAPACITY, QueueArrayGrowth::grow));
+                break;
+            case LaneType::chunk_list:
+                lanes.push_back(std::make_shared< QueueChunkList< CustomerId > >());
+                break;
+            case LaneType::intrusive:
+                lanes.push_back(std::make_shared< QueueIntrusive< CustomerId > >());
+                break;
+            case LaneType::linked_list:
+                lanes.push_back(std::make_shared< QueueList< CustomerId > >());
+                break;
+        }
+    }
+
+    // Simulation.
+    auto sim = ServiceQueueSimulation(
+        point.tellers,
+        std::shared_ptr< ArrivalSource >(new TraceArrivalSource(trace_ptr)),
+        lanes
+    );
+
+    // Keep the trace and summarize it in one pass (the pool already runs a point per core).
+    sim.retain_trace(1);
+
+    // Return.
+    return sim.run();
+}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Writes the CSV column names
+ *
+ * @param[out] output
+ *             Stream receiving the header
+ *
+ */
+void ParameterSweep::write_header(std::ostream& output)
+{
+    // Header.
+    output << "tellers,lanes,lane_type,customers,sim_time,"
+           << "average_wait,max_wait,wait_p90,wait_p99,"
+           << "average_sojourn,sojourn_p99,"
+           << "average_line_length,max_line_length,average_customers_waiting,"
+           << "utilization\n";
+}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Writes one point's CSV row; utilization is the fraction of
+ *          teller time not spent idle
+ *
+ * @param[out] output
+ *             Stream receiving the row
+ *
+ * @param[in] point
+ *             Point that was run
+ *
+ * @param[in] report
+ *            Report of its run
+ *
+ */
+void ParameterSweep::write_row(std::ostream& output, const Point& point, const SimulationReport& report)
+{
+    // Idle teller time.
+    auto idle = 0.0;
+    for (auto time : report.servicer_idle_times())
+    {
+        // Sum.
+        idle += time;
+    }
+
+    // Available teller time.
+    auto available = (double) report.sim_time() * point.tellers;
+
+    // Row.
+    output << point.tellers << ',' << point.lanes << ',' << lane_type_name(point.lane_type) << ','
+           << point.load << ',' << report.sim_time() << ','
+           << report.waits().mean() << ',' << report.waits().max() << ','
+           << report.wait_percentiles().p90 << ',' << report.wait_percentiles().p99 << ','
+           << report.sojourns().mean() << ',' << report.sojourn_percentiles().p99 << ','
+           << report.average_line_length() << ',' << report.max_line_length() << ','
+           << report.average_customers_waiting() << ','
+           << (available > 0.0 ? 1.0 - idle / available : 0.0) << '\n';
+}
+//
+//  Terminating Precompiler Directives  ////////////////////////////////////////
+//
+#endif // PARAMETER_SWEEP_CPP_
+//
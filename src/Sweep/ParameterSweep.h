@@ -0,0 +1,99 @@
+/**
+ *
+ * @file ParameterSweep.h
+ *
+ * @brief Runs a simulation at every point of a grid of teller counts, lane
+ *        counts, lane types, and loads
+ *
+ * @author Josh Wiley
+ *
+ * @details Defines the ParameterSweep class
+ *
+ */
+//
+//  Preprocessor Directives  ///////////////////////////////////////////////////
+//
+#ifndef PARAMETER_SWEEP_H_
+#define PARAMETER_SWEEP_H_
+//
+//  Header Files  //////////////////////////////////////////////////////////////
+//
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+#include <ostream>
+#include "../ThreadPool/ThreadPool.h"
+#include "../ServiceQueueSimulation/Customer.h"
+#include "../ServiceQueueSimulation/SimulationReport.h"
+//
+//  Class Definition  //////////////////////////////////////////////////////////
+//
+class ParameterSweep
+{
+
+// Public members.
+public:
+    enum class LaneType
+    {
+        array, /**< QueueArray (growing ring) */
+        chunk_list, /**< QueueChunkList */
+        intrusive, /**< QueueIntrusive (linked through the simulation's customers) */
+        linked_list /**< QueueList */
+    }; /**< Queue type of every lane at a point */
+
+    struct Point
+    {
+        unsigned int tellers; /**< Number of tellers (servicers) */
+        unsigned int lanes; /**< Number of lanes */
+        LaneType lane_type; /**< Queue type of the lanes */
+        unsigned int load; /**< Number of customers arriving over the arrival window */
+    }; /**< One point of the grid */
+
+    ParameterSweep(
+        std::vector< unsigned int > tellers,
+        std::vector< unsigned int > lanes,
+        std::vector< LaneType > lane_types,
+        std::vector< unsigned int > loads,
+        unsigned int arrival_min,
+        unsigned int arrival_max,
+        unsigned int transaction_min,
+        unsigned int transaction_max,
+        std::uint64_t seed
+    ); /**< Parameterized constructor */
+    ParameterSweep(const ParameterSweep&) = default; /**< Copy constructor */
+    ~ParameterSweep(); /**< Destructor */
+
+    size_t point_count() const; /**< Number of points in the grid */
+    Point point(size_t) const; /**< Point at an index (tellers vary slowest, loads fastest) */
+
+    void run(ThreadPool&, std::ostream&) const; /**< Runs every point across the pool and writes one CSV row per point, in index order */
+
+    static const char* lane_type_name(LaneType); /**< Name of a lane type, as written to the CSV */
+
+    ParameterSweep& operator=(const ParameterSweep&) = default; /**< Copy assignment operator */
+
+// Private members.
+private:
+    std::shared_ptr< const std::vector< Customer > > generate_trace(size_t) const; /**< Generates the arrival trace of a load level */
+    SimulationReport run_point(const Point&, std::shared_ptr< const std::vector< Customer > >) const; /**< Runs one point over its load's trace */
+
+    static void write_header(std::ostream&); /**< Writes the CSV column names */
+    static void write_row(std::ostream&, const Point&, const SimulationReport&); /**< Writes one point's CSV row */
+
+    std::vector< unsigned int > tellers_; /**< Teller counts */
+    std::vector< unsigned int > lanes_; /**< Lane counts */
+    std::vector< LaneType > lane_types_; /**< Lane types */
+    std::vector< unsigned int > loads_; /**< Loads (customers per arrival window) */
+    unsigned int arrival_min_; /**< Start of the arrival window */
+    unsigned int arrival_max_; /**< End of the arrival window */
+    unsigned int transaction_min_; /**< Minimum transaction length */
+    unsigned int transaction_max_; /**< Maximum transaction length */
+    std::uint64_t seed_; /**< Seed the traces' streams are derived from */
+
+};
+//
+//  Terminating Precompiler Directives  ////////////////////////////////////////
+//
+#endif // PARAMETER_SWEEP_H_
+//
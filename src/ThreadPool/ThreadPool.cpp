@@ -0,0 +1,225 @@
+/**
+ *
+ * @file ThreadPool.cpp
+ *
+ * @brief Fixed set of worker threads that run indexed tasks in parallel
+ *
+ * @author Josh Wiley
+ *
+ * @details Implements the ThreadPool class. A job is a task and a count;
+ *          the caller and every worker claim indices from a shared atomic
+ *          counter until none are left, so uneven tasks balance themselves.
+ *          Which thread runs an index is not fixed, so tasks that must give
+ *          the same result on any pool write to a slot of their index and
+ *          leave combining to the caller.
+ *
+ */
+//
+//  Preprocessor Directives  ///////////////////////////////////////////////////
+//
+#ifndef THREAD_POOL_CPP_
+#define THREAD_POOL_CPP_
+//
+//  Header Files  //////////////////////////////////////////////////////////////
+//
+#include <algorithm>
+#include "ThreadPool.h"
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Starts threads - 1 workers; the thread calling parallel_for makes
+ *          up the rest
+ *
+ * @param[in] threads
+ *            Number of threads jobs run on (0 for one per core)
+ *
+ */
+ThreadPool::ThreadPool(unsigned int threads)
+    : task_(nullptr), task_count_(0), next_index_(0), generation_(0),
+      busy_workers_(0), stopping_(false)
+{
+    // One per core?
+    if (threads == 0)
+    {
+        // Hardware threads.
+        threads = std::max(std::thread::hardware_concurrency(), 1u);
+    }
+
+    // Start workers.
+    for (auto i = 1u; i < threads; i++)
+    {
+        // Start.
+        workers_.push_back(std::thread(&ThreadPool::work, this));
+    }
+}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Destructor, wakes the workers to stop and joins them
+ *
+ */
+ThreadPool::~ThreadPool()
+{
+    // Stop.
+    {
+        std::lock_guard< std::mutex > lock(mutex_);
+        stopping_ = true;
+    }
+    job_ready_.notify_all();
+
+    // Join.
+    for (auto& worker : workers_)
+    {
+        // Join.
+        worker.join();
+    }
+}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Returns number of threads a job runs on
+ *
+ * @return Number of workers plus the calling thread
+ *
+ */
+unsigned int ThreadPool::thread_count() const
+{
+    // Return.
+    return (unsigned int) workers_.size() + 1;
+}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Posts the job, runs tasks on the calling thread alongside the
+ *          workers, and waits for every worker to leave the job. If tasks
+ *          throw, the rest still run and the first exception is rethrown
+ *          here. Tasks must not call parallel_for on the same pool.
+ *
+ * @param[in] count
+ *            Number of indices
+ *
+ * @param[in] task
+ *            Task called once with each index in [0, count)
+ *
+ */
+void ThreadPool::parallel_for(size_t count, const std::function< void(size_t) >& task)
+{
+    // One job at a time.
+    std::lock_guard< std::mutex > submit(submit_mutex_);
+
+    // Post.
+    {
+        std::lock_guard< std::mutex > lock(mutex_);
+        task_ = &task;
+        task_count_ = count;
+        next_index_.store(0, std::memory_order_relaxed);
+        error_ = nullptr;
+        busy_workers_ = workers_.size();
+        generation_++;
+    }
+    job_ready_.notify_all();
+
+    // Help.
+    drain();
+
+    // Wait for workers.
+    std::unique_lock< std::mutex > lock(mutex_);
+    job_done_.wait(lock, [this] () { return busy_workers_ == 0; });
+    task_ = nullptr;
+
+    // Failed?
+    if (error_)
+    {
+        // Rethrow.
+        std::rethrow_exception(error_);
+    }
+}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Worker loop: sleeps until a new job is posted, helps run it, and
+ *          reports leaving it, until the pool stops
+ *
+ */
+void ThreadPool::work()
+{
+    // Last job seen.
+    auto seen = (size_t) 0;
+
+    // Jobs.
+    while (true)
+    {
+        // Wait for a new job.
+        {
+            std::unique_lock< std::mutex > lock(mutex_);
+            job_ready_.wait(lock, [&] () { return stopping_ || generation_ != seen; });
+
+            // Stopped?
+            if (stopping_)
+            {
+                // Return.
+                return;
+            }
+            seen = generation_;
+        }
+
+        // Help.
+        drain();
+
+        // Leave.
+        std::lock_guard< std::mutex > lock(mutex_);
+        if (--busy_workers_ == 0)
+        {
+            // Last one out.
+            job_done_.notify_all();
+        }
+    }
+}
+//
+//  Class Member Implementation  ///////////////////////////////////////////////
+//
+/**
+ *
+ * @details Claims and runs indices of the current job until none are left,
+ *          keeping the first exception thrown
+ *
+ */
+void ThreadPool::drain()
+{
+    // Claim.
+    for (auto index = next_index_.fetch_add(1, std::memory_order_relaxed);
+         index < task_count_;
+         index = next_index_.fetch_add(1, std::memory_order_relaxed))
+    {
+        // Run.
+        try
+        {
+            (*task_)(index);
+        }
+        catch (...)
+        {
+            // Keep the first.
+            std::lock_guard< std::mutex > lock(mutex_);
+            if (!error_)
+            {
+                // Keep.
+                error_ = std::current_exception();
+            }
+        }
+    }
+}
+//
+//  Terminating Precompiler Directives  ////////////////////////////////////////
+//
+#endif // THREAD_POOL_CPP_
+//
@@ -0,0 +1,68 @@
+/**
+ *
+ * @file ThreadPool.h
+ *
+ * @brief Fixed set of worker threads that run indexed tasks in parallel
+ *
+ * @author Josh Wiley
+ *
+ * @details Defines the ThreadPool class
+ *
+ */
+//
+//  Preprocessor Directives  ///////////////////////////////////////////////////
+//
+#ifndef THREAD_POOL_H_
+#define THREAD_POOL_H_
+//
+//  Header Files  //////////////////////////////////////////////////////////////
+//
+#include <cstddef>
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <functional>
+#include <exception>
+//
+//  Class Definition  //////////////////////////////////////////////////////////
+//
+class ThreadPool
+{
+
+// Public members.
+public:
+    ThreadPool(unsigned int threads = 0); /**< Parameterized constructor (0 threads = one per core) */
+    ThreadPool(const ThreadPool&) = delete; /**< Not copyable (owns its threads) */
+    ~ThreadPool(); /**< Destructor, stops and joins the workers */
+
+    unsigned int thread_count() const; /**< Returns number of threads a job runs on, counting the caller */
+    void parallel_for(size_t, const std::function< void(size_t) >&); /**< Runs a task for each index in [0, n) across the threads, returns once all are done */
+
+    ThreadPool& operator=(const ThreadPool&) = delete; /**< Not assignable (owns its threads) */
+
+// Private members.
+private:
+    void work(); /**< Worker loop: waits for a job, helps run it, repeats until stopped */
+    void drain(); /**< Runs tasks of the current job until no index is left */
+
+    std::vector< std::thread > workers_; /**< Worker threads (the caller of parallel_for is the last thread) */
+    std::mutex submit_mutex_; /**< Serializes jobs submitted from different threads */
+    std::mutex mutex_; /**< Guards the job state below */
+    std::condition_variable job_ready_; /**< Signaled when a job is posted or the pool stops */
+    std::condition_variable job_done_; /**< Signaled when the last worker leaves a job */
+    const std::function< void(size_t) >* task_; /**< Task of the current job */
+    size_t task_count_; /**< Number of indices in the current job */
+    std::atomic< size_t > next_index_; /**< Next index of the current job to claim */
+    size_t generation_; /**< Number of jobs posted, so workers can tell a new job from a spurious wake */
+    size_t busy_workers_; /**< Number of workers still inside the current job */
+    std::exception_ptr error_; /**< First exception thrown by a task of the current job */
+    bool stopping_; /**< Set by the destructor */
+
+};
+//
+//  Terminating Precompiler Directives  ////////////////////////////////////////
+//
+#endif // THREAD_POOL_H_
+//
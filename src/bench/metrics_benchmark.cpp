@@ -0,0 +1,186 @@
+/**
+ *
+ * @file metrics_benchmark.cpp
+ *
+ * @brief Benchmark for the post-run analytics kernels.
+ *
+ * @author Josh Wiley
+ *
+ * @details Builds a synthetic trace of NUM_CUSTOMERS arrival, transaction
+ *          length, and departure times and times folding it into completion
+ *          statistics one customer at a time (CompletionSink::record) against
+ *          column_kernels::summarize_customers at increasing thread counts,
+ *          checking that every summary agrees with the reference.
+ *
+ */
+//
+//  Preprocessor Directives  ///////////////////////////////////////////////////
+//
+#ifndef METRICS_BENCHMARK_CPP_
+#define METRICS_BENCHMARK_CPP_
+#define NUM_CUSTOMERS (size_t) 10000000
+#define MAX_THREADS (unsigned int) 8
+#define SEED (unsigned int) 20160
+//
+//  Header Files  //////////////////////////////////////////////////////////////
+//
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <vector>
+#include <random>
+#include <chrono>
+#include <cmath>
+#include <thread>
+#include "../utils/column_kernels.h"
+#include "../ServiceQueueSimulation/CompletionSink.h"
+//
+//  Function Implementation  ///////////////////////////////////////////////////
+//
+/**
+ *
+ * @brief Returns whether two summaries of the same trace agree
+ *
+ * @details Counts, sums, extrema, and percentiles must match exactly;
+ *          deviations within a relative 1e-9 (the order of the floating-point
+ *          additions differs)
+ *
+ * @param[in] a
+ *            First summary
+ *
+ * @param[in] b
+ *            Second summary
+ *
+ * @return Boolean value indicating agreement
+ *
+ */
+bool agree(const CompletionSink& a, const CompletionSink& b)
+{
+  // Statistics pairs.
+  const RunningStatistics* pairs[2][2] = {
+    { &a.waits(), &b.waits() },
+    { &a.sojourns(), &b.sojourns() }
+  };
+
+  // Each pair.
+  for (auto& pair : pairs)
+  {
+    // Exact parts.
+    if (pair[0]->count() != pair[1]->count() || pair[0]->sum() != pair[1]->sum()
+      || pair[0]->min() != pair[1]->min() || pair[0]->max() != pair[1]->max())
+    {
+      // Disagree.
+      return false;
+    }
+
+    // Deviation.
+    auto deviation = pair[0]->standard_deviation();
+    if (std::fabs(deviation - pair[1]->standard_deviation()) > 1e-9 * std::max(deviation, 1.0))
+    {
+      // Disagree.
+      return false;
+    }
+  }
+
+  // Percentiles.
+  for (auto percentile : { 50.0, 90.0, 99.0, 99.9 })
+  {
+    // Same bucket?
+    if (a.wait_histogram().value_at_percentile(percentile) != b.wait_histogram().value_at_percentile(percentile)
+      || a.sojourn_histogram().value_at_percentile(percentile) != b.sojourn_histogram().value_at_percentile(percentile))
+    {
+      // Disagree.
+      return false;
+    }
+  }
+
+  // Agree.
+  return true;
+}
+//
+//  Function Implementation  ///////////////////////////////////////////////////
+//
+/**
+ *
+ * @brief Returns milliseconds elapsed since a start time
+ *
+ * @param[in] start
+ *            Start time
+ *
+ * @return Milliseconds elapsed
+ *
+ */
+double milliseconds_since(std::chrono::high_resolution_clock::time_point start)
+{
+  // Return.
+  return std::chrono::duration< double, std::milli >(
+    std::chrono::high_resolution_clock::now() - start
+  ).count();
+}
+//
+//  Main Function Implementation  //////////////////////////////////////////////
+//
+int main()
+{
+  // Trace columns.
+  auto arrivals = std::vector< unsigned int >(NUM_CUSTOMERS);
+  auto lengths = std::vector< unsigned int >(NUM_CUSTOMERS);
+  auto departures = std::vector< unsigned int >(NUM_CUSTOMERS);
+
+  // Synthetic trace (waits drawn geometrically, so the tail is long).
+  auto engine = std::mt19937(SEED);
+  auto gap = std::uniform_int_distribution< unsigned int >(0, 3);
+  auto length = std::uniform_int_distribution< unsigned int >(1, 100);
+  auto wait = std::geometric_distribution< unsigned int >(0.01);
+  auto time = (unsigned int) 0;
+  for (auto i = (size_t) 0; i < NUM_CUSTOMERS; i++)
+  {
+    // Customer.
+    time += gap(engine);
+    arrivals[i] = time;
+    lengths[i] = length(engine);
+    departures[i] = time + wait(engine) + lengths[i];
+  }
+
+  // Header.
+  std::cout << "Metrics benchmark: " << NUM_CUSTOMERS << " customers, "
+    << column_kernels::instruction_set() << ", "
+    << std::thread::hardware_concurrency() << " hardware threads" << std::endl;
+  std::cout << std::setw(24) << "method" << std::setw(12) << "ms"
+    << std::setw(10) << "agrees" << std::endl;
+
+  // Reference: one customer at a time.
+  auto start = std::chrono::high_resolution_clock::now();
+  auto reference = CompletionSink();
+  for (auto i = (size_t) 0; i < NUM_CUSTOMERS; i++)
+  {
+    // Record.
+    reference.record(arrivals[i], departures[i] - lengths[i], departures[i]);
+  }
+  std::cout << std::setw(24) << "CompletionSink::record" << std::fixed << std::setprecision(1)
+    << std::setw(12) << milliseconds_since(start) << std::setw(10) << "-" << std::endl;
+
+  // Kernels.
+  for (auto threads = (unsigned int) 1; threads <= MAX_THREADS; threads *= 2)
+  {
+    // Summarize.
+    start = std::chrono::high_resolution_clock::now();
+    auto summary = column_kernels::summarize_customers(
+      arrivals.data(), lengths.data(), departures.data(), NUM_CUSTOMERS, threads
+    );
+    auto elapsed = milliseconds_since(start);
+
+    // Row.
+    std::cout << std::setw(24) << ("kernels, " + std::to_string(threads) + " threads")
+      << std::setw(12) << elapsed
+      << std::setw(10) << (agree(reference, summary) ? "yes" : "NO") << std::endl;
+  }
+
+  // Return.
+  return 0;
+}
+//
+//  Terminating Precompiler Directives  ////////////////////////////////////////
+//
+#endif // METRICS_BENCHMARK_CPP_
+//
@@ -0,0 +1,172 @@
+/**
+ *
+ * @file queue_benchmark.cpp
+ *
+ * @brief Contention benchmark for the concurrent queues.
+ *
+ * @author Josh Wiley
+ *
+ * @details Pushes customer ids through a queue shared by producer threads
+ *          (arrivals) and consumer threads (tellers) and reports throughput
+ *          against thread count, for the lock-free QueueMpmc and for a
+ *          QueueArray guarded by a mutex.
+ *
+ */
+//
+//  Preprocessor Directives  ///////////////////////////////////////////////////
+//
+#ifndef QUEUE_BENCHMARK_CPP_
+#define QUEUE_BENCHMARK_CPP_
+#define NUM_ITEMS (size_t) 2000000
+#define QUEUE_CAPACITY (size_t) 1024
+#define MAX_THREADS_PER_SIDE (unsigned int) 8
+//
+//  Header Files  //////////////////////////////////////////////////////////////
+//
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <atomic>
+#include <chrono>
+#include "../Queue/QueueArray.h"
+#include "../Queue/QueueMpmc.h"
+#include "../ServiceQueueSimulation/CustomerTable.h"
+//
+//  Function Implementation  ///////////////////////////////////////////////////
+//
+/**
+ *
+ * @brief Runs one trial and returns its throughput
+ *
+ * @details Starts threads producers that push NUM_ITEMS ids between them and
+ *          threads consumers that pop until every id is through, yielding
+ *          whenever the queue is full or empty
+ *
+ * @param[in] threads
+ *            Number of producers, and of consumers
+ *
+ * @param[in] push
+ *            Callable pushing one id, returning boolean indicating success
+ *
+ * @param[in] pop
+ *            Callable popping one id into its argument, returning boolean
+ *            indicating success
+ *
+ * @return Millions of items moved per second
+ *
+ */
+template<class P, class C>
+double run_trial(unsigned int threads, P push, C pop)
+{
+  // Shared progress.
+  std::atomic< size_t > consumed(0);
+  auto workers = std::vector< std::thread >();
+
+  // Start clock.
+  auto start = std::chrono::high_resolution_clock::now();
+
+  // Producers.
+  for (auto t = (unsigned int) 0; t < threads; t++)
+  {
+    // Push an even share.
+    workers.push_back(std::thread([&, t] () {
+      for (auto i = (size_t) t; i < NUM_ITEMS; i += threads)
+      {
+        // Wait for room.
+        while (!push((CustomerId) i))
+        {
+          // Back off.
+          std::this_thread::yield();
+        }
+      }
+    }));
+  }
+
+  // Consumers.
+  for (auto t = (unsigned int) 0; t < threads; t++)
+  {
+    // Pop until everything is through.
+    workers.push_back(std::thread([&] () {
+      auto id = (CustomerId) 0;
+      while (consumed.load(std::memory_order_relaxed) < NUM_ITEMS)
+      {
+        // Popped?
+        if (pop(id))
+        {
+          // Count.
+          consumed.fetch_add(1, std::memory_order_relaxed);
+        }
+        else
+        {
+          // Back off.
+          std::this_thread::yield();
+        }
+      }
+    }));
+  }
+
+  // Wait.
+  for (auto& worker : workers)
+  {
+    // Join.
+    worker.join();
+  }
+
+  // Stop clock.
+  auto seconds = std::chrono::duration< double >(
+    std::chrono::high_resolution_clock::now() - start
+  ).count();
+
+  // Return throughput.
+  return NUM_ITEMS / seconds / 1e6;
+}
+//
+//  Main Function Implementation  //////////////////////////////////////////////
+//
+int main()
+{
+  // Header.
+  std::cout << "Queue contention benchmark: " << NUM_ITEMS << " items, "
+    << QUEUE_CAPACITY << " slots, " << std::thread::hardware_concurrency()
+    << " hardware threads" << std::endl;
+  std::cout << std::setw(10) << "threads" << std::setw(18) << "QueueMpmc Mops/s"
+    << std::setw(26) << "locked QueueArray Mops/s" << std::endl;
+
+  // Thread counts.
+  for (auto threads = (unsigned int) 1; threads <= MAX_THREADS_PER_SIDE; threads *= 2)
+  {
+    // Lock-free queue.
+    QueueMpmc< CustomerId > lock_free(QUEUE_CAPACITY);
+    auto lock_free_rate = run_trial(
+      threads,
+      [&] (CustomerId id) { return lock_free.enqueue(id); },
+      [&] (CustomerId& id) { return lock_free.try_pop(id); }
+    );
+
+    // Mutex-guarded queue.
+    auto locked = QueueArray< CustomerId >(QUEUE_CAPACITY);
+    std::mutex lock;
+    auto locked_rate = run_trial(
+      threads,
+      [&] (CustomerId id) { std::lock_guard< std::mutex > guard(lock); return locked.enqueue(id); },
+      [&] (CustomerId& id) { std::lock_guard< std::mutex > guard(lock); return locked.try_pop(id); }
+    );
+
+    // Row.
+    std::cout << std::setw(10) << (std::to_string(threads) + "+" + std::to_string(threads))
+      << std::fixed << std::setprecision(2)
+      << std::setw(18) << lock_free_rate
+      << std::setw(26) << locked_rate << std::endl;
+  }
+
+  // Return.
+  return 0;
+}
+//
+//  Terminating Precompiler Directives  ////////////////////////////////////////
+//
+#endif // QUEUE_BENCHMARK_CPP_
+//
@@ -0,0 +1,80 @@
+/**
+ *
+ * @file sweep.cpp
+ *
+ * @brief Driver for a capacity-planning sweep of the bank teller queue.
+ *
+ * @author Josh Wiley
+ *
+ * @details Simulates every combination of teller count, lane count, lane
+ *          queue type, and load below, spread over every core, and writes
+ *          one CSV row per combination to sweep.csv.
+ *
+ */
+//
+//  Preprocessor Directives  ///////////////////////////////////////////////////
+//
+#ifndef SWEEP_CPP_
+#define SWEEP_CPP_
+#define MIN_START_TIME (unsigned int) 0
+#define MAX_START_TIME (unsigned int) 100000
+#define MIN_TRANSACTION_TIME (unsigned int) 0
+#define MAX_TRANSACTION_TIME (unsigned int) 100
+#define SWEEP_SEED (std::uint64_t) 20160405
+//
+//  Header Files  //////////////////////////////////////////////////////////////
+//
+#include <iostream>
+#include <fstream>
+#include <chrono>
+#include <cstdint>
+#include "ThreadPool/ThreadPool.h"
+#include "Sweep/ParameterSweep.h"
+//
+//  Main Function Implementation  //////////////////////////////////////////////
+//
+int main()
+{
+  // Grid (loads are customers arriving over the window; 0-100 unit transactions).
+  auto sweep = ParameterSweep(
+    { 1, 2, 3, 4, 6, 8, 12, 16 },
+    { 1, 2, 3, 4 },
+    {
+      ParameterSweep::LaneType::array,
+      ParameterSweep::LaneType::chunk_list,
+      ParameterSweep::LaneType::intrusive,
+      ParameterSweep::LaneType::linked_list
+    },
+    { 10000, 25000, 50000, 100000 },
+    MIN_START_TIME,
+    MAX_START_TIME,
+    MIN_TRANSACTION_TIME,
+    MAX_TRANSACTION_TIME,
+    SWEEP_SEED
+  );
+
+  // Threads.
+  ThreadPool pool;
+
+  // Checkpoint.
+  std::cout << "\n\nSweeping " << sweep.point_count() << " points on "
+    << pool.thread_count() << " threads...\n" << std::endl;
+
+  // Run.
+  auto start = std::chrono::high_resolution_clock::now();
+  auto output = std::ofstream("sweep.csv");
+  sweep.run(pool, output);
+
+  // Checkpoint.
+  std::cout << "\n\nWrote sweep.csv in " << std::chrono::duration_cast< std::chrono::milliseconds >(
+    std::chrono::high_resolution_clock::now() - start
+  ).count() << " milliseconds\n" << std::endl;
+
+  // Return.
+  return 0;
+}
+//
+//  Terminating Precompiler Directives  ////////////////////////////////////////
+//
+#endif // SWEEP_CPP_
+//
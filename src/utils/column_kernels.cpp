@@ -0,0 +1,536 @@
+/**
+ *
+ * @file column_kernels.cpp
+ *
+ * @brief Namespace for vectorized, multi-threaded reductions over customer
+ *        columns.
+ *
+ * @author Josh Wiley
+ *
+ * @details Each kernel runs 8 (AVX2) or 4 (SSE2) customers per instruction
+ *          and finishes the remainder with scalar code. summarize_customers
+ *          cuts the trace into fixed-length chunks that threads take in turn;
+ *          every chunk is summarized on its own and the summaries are merged
+ *          in chunk order, so the result does not depend on the number of
+ *          threads.
+ *
+ */
+//
+//  Preprocessor Directives  ///////////////////////////////////////////////////
+//
+#ifndef COLUMN_KERNELS_CPP_
+#define COLUMN_KERNELS_CPP_
+#define CHUNK_LENGTH (size_t) 65536
+#define MIN_CUSTOMERS_PER_THREAD (size_t) 262144
+#define UNSIGNED_BIAS (double) 2147483648.0
+//
+//  Header Files  //////////////////////////////////////////////////////////////
+//
+#include <vector>
+#include <thread>
+#include <limits>
+#include <algorithm>
+#include "column_kernels.h"
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+//
+//  Function Implementation  ///////////////////////////////////////////////////
+//
+/**
+ *
+ * @brief Returns name of the vector instruction set in use
+ *
+ * @return "AVX2", "SSE2", or "scalar"
+ *
+ */
+const char* column_kernels::instruction_set()
+{
+#if defined(__AVX2__)
+  // Return.
+  return "AVX2";
+#elif defined(__SSE2__)
+  // Return.
+  return "SSE2";
+#else
+  // Return.
+  return "scalar";
+#endif
+}
+//
+//  Function Implementation  ///////////////////////////////////////////////////
+//
+/**
+ *
+ * @brief Computes wait and sojourn columns
+ *
+ * @details Sojourn is departure - arrival and wait is sojourn - transaction
+ *          length, both in unsigned 32-bit arithmetic
+ *
+ * @param[in] arrivals
+ *            Arrival time column
+ *
+ * @param[in] lengths
+ *            Transaction length column
+ *
+ * @param[in] departures
+ *            Departure time column
+ *
+ * @param[in] count
+ *            Number of customers
+ *
+ * @param[out] waits
+ *             Receives count wait times
+ *
+ * @param[out] sojourns
+ *             Receives count sojourn times
+ *
+ */
+void column_kernels::waits_and_sojourns(
+  const unsigned int* arrivals,
+  const unsigned int* lengths,
+  const unsigned int* departures,
+  size_t count,
+  unsigned int* waits,
+  unsigned int* sojourns
+)
+{
+  // Position.
+  auto i = (size_t) 0;
+
+#if defined(__AVX2__)
+  // Eight at a time.
+  for (; i + 8 <= count; i += 8)
+  {
+    // Load.
+    auto a = _mm256_loadu_si256((const __m256i*) (arrivals + i));
+    auto l = _mm256_loadu_si256((const __m256i*) (lengths + i));
+    auto d = _mm256_loadu_si256((const __m256i*) (departures + i));
+
+    // Subtract and store.
+    auto s = _mm256_sub_epi32(d, a);
+    _mm256_storeu_si256((__m256i*) (sojourns + i), s);
+    _mm256_storeu_si256((__m256i*) (waits + i), _mm256_sub_epi32(s, l));
+  }
+#elif defined(__SSE2__)
+  // Four at a time.
+  for (; i + 4 <= count; i += 4)
+  {
+    // Load.
+    auto a = _mm_loadu_si128((const __m128i*) (arrivals + i));
+    auto l = _mm_loadu_si128((const __m128i*) (lengths + i));
+    auto d = _mm_loadu_si128((const __m128i*) (departures + i));
+
+    // Subtract and store.
+    auto s = _mm_sub_epi32(d, a);
+    _mm_storeu_si128((__m128i*) (sojourns + i), s);
+    _mm_storeu_si128((__m128i*) (waits + i), _mm_sub_epi32(s, l));
+  }
+#endif
+
+  // Remainder.
+  for (; i < count; i++)
+  {
+    // Subtract.
+    sojourns[i] = departures[i] - arrivals[i];
+    waits[i] = sojourns[i] - lengths[i];
+  }
+}
+//
+//  Function Implementation  ///////////////////////////////////////////////////
+//
+/**
+ *
+ * @brief Computes sum and extrema of a column
+ *
+ * @details Widens each value to 64 bits before adding, so the sum is exact
+ *
+ * @param[in] values
+ *            Column
+ *
+ * @param[in] count
+ *            Number of values
+ *
+ * @param[out] sum
+ *             Assigned sum of values
+ *
+ * @param[out] min
+ *             Assigned smallest value (0 if none)
+ *
+ * @param[out] max
+ *             Assigned largest value (0 if none)
+ *
+ */
+void column_kernels::sum_min_max(
+  const unsigned int* values,
+  size_t count,
+  std::uint64_t& sum,
+  unsigned int& min,
+  unsigned int& max
+)
+{
+  // Position and running results.
+  auto i = (size_t) 0;
+  sum = 0;
+  min = std::numeric_limits< unsigned int >::max();
+  max = 0;
+
+#if defined(__AVX2__)
+  // Lane accumulators.
+  auto sums = _mm256_setzero_si256();
+  auto mins = _mm256_set1_epi32(-1);
+  auto maxs = _mm256_setzero_si256();
+
+  // Eight at a time.
+  for (; i + 8 <= count; i += 8)
+  {
+    // Load.
+    auto v = _mm256_loadu_si256((const __m256i*) (values + i));
+
+    // Extrema.
+    mins = _mm256_min_epu32(mins, v);
+    maxs = _mm256_max_epu32(maxs, v);
+
+    // Widen and add.
+    sums = _mm256_add_epi64(sums, _mm256_cvtepu32_epi64(_mm256_castsi256_si128(v)));
+    sums = _mm256_add_epi64(sums, _mm256_cvtepu32_epi64(_mm256_extracti128_si256(v, 1)));
+  }
+
+  // Reduce lanes.
+  alignas(32) std::uint64_t lane_sums[4];
+  alignas(32) unsigned int lane_mins[8];
+  alignas(32) unsigned int lane_maxs[8];
+  _mm256_store_si256((__m256i*) lane_sums, sums);
+  _mm256_store_si256((__m256i*) lane_mins, mins);
+  _mm256_store_si256((__m256i*) lane_maxs, maxs);
+  for (auto lane = 0; lane < 8; lane++)
+  {
+    // Combine.
+    sum += lane < 4 ? lane_sums[lane] : 0;
+    min = std::min(min, lane_mins[lane]);
+    max = std::max(max, lane_maxs[lane]);
+  }
+#elif defined(__SSE2__)
+  // Lane accumulators (extrema biased to signed, as SSE2 only compares signed).
+  auto zero = _mm_setzero_si128();
+  auto bias = _mm_set1_epi32(std::numeric_limits< int >::min());
+  auto sums = _mm_setzero_si128();
+  auto mins = _mm_set1_epi32(std::numeric_limits< int >::max());
+  auto maxs = _mm_set1_epi32(std::numeric_limits< int >::min());
+
+  // Four at a time.
+  for (; i + 4 <= count; i += 4)
+  {
+    // Load.
+    auto v = _mm_loadu_si128((const __m128i*) (values + i));
+
+    // Widen and add.
+    sums = _mm_add_epi64(sums, _mm_unpacklo_epi32(v, zero));
+    sums = _mm_add_epi64(sums, _mm_unpackhi_epi32(v, zero));
+
+    // Extrema.
+    auto biased = _mm_xor_si128(v, bias);
+    auto less = _mm_cmplt_epi32(biased, mins);
+    auto greater = _mm_cmpgt_epi32(biased, maxs);
+    mins = _mm_or_si128(_mm_and_si128(less, biased), _mm_andnot_si128(less, mins));
+    maxs = _mm_or_si128(_mm_and_si128(greater, biased), _mm_andnot_si128(greater, maxs));
+  }
+
+  // Reduce lanes (removing the bias).
+  alignas(16) std::uint64_t lane_sums[2];
+  alignas(16) unsigned int lane_mins[4];
+  alignas(16) unsigned int lane_maxs[4];
+  _mm_store_si128((__m128i*) lane_sums, sums);
+  _mm_store_si128((__m128i*) lane_mins, _mm_xor_si128(mins, bias));
+  _mm_store_si128((__m128i*) lane_maxs, _mm_xor_si128(maxs, bias));
+  for (auto lane = 0; lane < 4; lane++)
+  {
+    // Combine.
+    sum += lane < 2 ? lane_sums[lane] : 0;
+    min = std::min(min, lane_mins[lane]);
+    max = std::max(max, lane_maxs[lane]);
+  }
+#endif
+
+  // Remainder.
+  for (; i < count; i++)
+  {
+    // Combine.
+    sum += values[i];
+    min = std::min(min, values[i]);
+    max = std::max(max, values[i]);
+  }
+
+  // Empty?
+  if (count == 0)
+  {
+    // No min.
+    min = 0;
+  }
+}
+//
+//  Function Implementation  ///////////////////////////////////////////////////
+//
+/**
+ *
+ * @brief Computes the sum of squared deviations of a column
+ *
+ * @details Converts each value to double exactly (through the signed
+ *          conversion, biased) before subtracting the mean
+ *
+ * @param[in] values
+ *            Column
+ *
+ * @param[in] count
+ *            Number of values
+ *
+ * @param[in] mean
+ *            Mean to measure deviations from
+ *
+ * @return Sum of (value - mean)^2
+ *
+ */
+double column_kernels::sum_squared_deviations(const unsigned int* values, size_t count, double mean)
+{
+  // Position and running result.
+  auto i = (size_t) 0;
+  auto total = 0.0;
+
+#if defined(__AVX2__)
+  // Lane accumulators.
+  auto bias = _mm256_set1_epi32(std::numeric_limits< int >::min());
+  auto offset = _mm256_set1_pd(UNSIGNED_BIAS);
+  auto means = _mm256_set1_pd(mean);
+  auto low_sums = _mm256_setzero_pd();
+  auto high_sums = _mm256_setzero_pd();
+
+  // Eight at a time.
+  for (; i + 8 <= count; i += 8)
+  {
+    // Load and bias.
+    auto v = _mm256_xor_si256(_mm256_loadu_si256((const __m256i*) (values + i)), bias);
+
+    // Deviations.
+    auto low = _mm256_sub_pd(_mm256_add_pd(_mm256_cvtepi32_pd(_mm256_castsi256_si128(v)), offset), means);
+    auto high = _mm256_sub_pd(_mm256_add_pd(_mm256_cvtepi32_pd(_mm256_extracti128_si256(v, 1)), offset), means);
+
+    // Square and add.
+    low_sums = _mm256_add_pd(low_sums, _mm256_mul_pd(low, low));
+    high_sums = _mm256_add_pd(high_sums, _mm256_mul_pd(high, high));
+  }
+
+  // Reduce lanes.
+  alignas(32) double lane_sums[4];
+  _mm256_store_pd(lane_sums, _mm256_add_pd(low_sums, high_sums));
+  total = (lane_sums[0] + lane_sums[1]) + (lane_sums[2] + lane_sums[3]);
+#elif defined(__SSE2__)
+  // Lane accumulators.
+  auto bias = _mm_set1_epi32(std::numeric_limits< int >::min());
+  auto offset = _mm_set1_pd(UNSIGNED_BIAS);
+  auto means = _mm_set1_pd(mean);
+  auto low_sums = _mm_setzero_pd();
+  auto high_sums = _mm_setzero_pd();
+
+  // Four at a time.
+  for (; i + 4 <= count; i += 4)
+  {
+    // Load and bias.
+    auto v = _mm_xor_si128(_mm_loadu_si128((const __m128i*) (values + i)), bias);
+
+    // Deviations.
+    auto low = _mm_sub_pd(_mm_add_pd(_mm_cvtepi32_pd(v), offset), means);
+    auto high = _mm_sub_pd(_mm_add_pd(_mm_cvtepi32_pd(_mm_srli_si128(v, 8)), offset), means);
+
+    // Square and add.
+    low_sums = _mm_add_pd(low_sums, _mm_mul_pd(low, low));
+    high_sums = _mm_add_pd(high_sums, _mm_mul_pd(high, high));
+  }
+
+  // Reduce lanes.
+  alignas(16) double lane_sums[2];
+  _mm_store_pd(lane_sums, _mm_add_pd(low_sums, high_sums));
+  total = lane_sums[0] + lane_sums[1];
+#endif
+
+  // Remainder.
+  for (; i < count; i++)
+  {
+    // Square and add.
+    auto deviation = (double) values[i] - mean;
+    total += deviation * deviation;
+  }
+
+  // Return.
+  return total;
+}
+//
+//  Function Implementation  ///////////////////////////////////////////////////
+//
+/**
+ *
+ * @brief Summarizes a column
+ *
+ * @details Takes the sum and extrema in one pass and the squared deviations
+ *          from the resulting mean in a second (two-pass variance, which does
+ *          not cancel the way a single sum of squares does)
+ *
+ * @param[in] values
+ *            Column
+ *
+ * @param[in] count
+ *            Number of values
+ *
+ * @return Summary of the column
+ *
+ */
+RunningStatistics column_kernels::summarize_column(const unsigned int* values, size_t count)
+{
+  // Empty?
+  if (count == 0)
+  {
+    // Return.
+    return RunningStatistics();
+  }
+
+  // First pass.
+  auto sum = (std::uint64_t) 0;
+  auto min = (unsigned int) 0;
+  auto max = (unsigned int) 0;
+  sum_min_max(values, count, sum, min, max);
+
+  // Second pass.
+  auto m2 = sum_squared_deviations(values, count, (double) sum / count);
+
+  // Return.
+  return RunningStatistics(count, (double) sum, min, max, m2);
+}
+//
+//  Function Implementation  ///////////////////////////////////////////////////
+//
+/**
+ *
+ * @brief Folds every customer of a trace into completion statistics
+ *
+ * @details Threads take fixed-length chunks in turn; each chunk's wait and
+ *          sojourn columns are computed and summarized with the vectorized
+ *          kernels and binned into the thread's histograms. Chunk summaries
+ *          are merged in chunk order and histograms are plain counts, so the
+ *          result is the same for any number of threads
+ *
+ * @param[in] arrivals
+ *            Arrival time column
+ *
+ * @param[in] lengths
+ *            Transaction length column
+ *
+ * @param[in] departures
+ *            Departure time column
+ *
+ * @param[in] count
+ *            Number of customers
+ *
+ * @param[in] threads
+ *            Number of threads to use (0 for one per core); fewer are started
+ *            if the trace is too short to share
+ *
+ * @return Completion statistics of the trace
+ *
+ */
+CompletionSink column_kernels::summarize_customers(
+  const unsigned int* arrivals,
+  const unsigned int* lengths,
+  const unsigned int* departures,
+  size_t count,
+  unsigned int threads
+)
+{
+  // One per core?
+  if (threads == 0)
+  {
+    // Hardware threads.
+    threads = std::max(std::thread::hardware_concurrency(), 1u);
+  }
+
+  // Enough work for each thread.
+  threads = (unsigned int) std::min(
+    (size_t) threads,
+    std::max(count / MIN_CUSTOMERS_PER_THREAD, (size_t) 1)
+  );
+
+  // Per-chunk summaries and per-thread histograms.
+  auto chunks = (count + CHUNK_LENGTH - 1) / CHUNK_LENGTH;
+  auto chunk_waits = std::vector< RunningStatistics >(chunks);
+  auto chunk_sojourns = std::vector< RunningStatistics >(chunks);
+  auto wait_histograms = std::vector< HdrHistogram >(threads);
+  auto sojourn_histograms = std::vector< HdrHistogram >(threads);
+
+  // Work of one thread.
+  auto work = [&] (unsigned int thread) {
+    // Chunk columns.
+    auto waits = std::vector< unsigned int >(CHUNK_LENGTH);
+    auto sojourns = std::vector< unsigned int >(CHUNK_LENGTH);
+
+    // Every threads-th chunk.
+    for (auto chunk = (size_t) thread; chunk < chunks; chunk += threads)
+    {
+      // Bounds.
+      auto first = chunk * CHUNK_LENGTH;
+      auto length = std::min(CHUNK_LENGTH, count - first);
+
+      // Columns.
+      waits_and_sojourns(arrivals + first, lengths + first, departures + first, length, waits.data(), sojourns.data());
+
+      // Summaries.
+      chunk_waits[chunk] = summarize_column(waits.data(), length);
+      chunk_sojourns[chunk] = summarize_column(sojourns.data(), length);
+
+      // Histograms.
+      wait_histograms[thread].record_range(waits.data(), waits.data() + length);
+      sojourn_histograms[thread].record_range(sojourns.data(), sojourns.data() + length);
+    }
+  };
+
+  // Start helpers, and work on this thread too.
+  auto helpers = std::vector< std::thread >();
+  for (auto thread = 1u; thread < threads; thread++)
+  {
+    // Start.
+    helpers.push_back(std::thread(work, thread));
+  }
+  work(0);
+
+  // Wait.
+  for (auto& helper : helpers)
+  {
+    // Join.
+    helper.join();
+  }
+
+  // Merge summaries in chunk order.
+  auto waits = RunningStatistics();
+  auto sojourns = RunningStatistics();
+  for (auto chunk = (size_t) 0; chunk < chunks; chunk++)
+  {
+    // Merge.
+    waits.merge(chunk_waits[chunk]);
+    sojourns.merge(chunk_sojourns[chunk]);
+  }
+
+  // Merge histograms.
+  for (auto thread = (size_t) 1; thread < threads; thread++)
+  {
+    // Merge.
+    wait_histograms[0].merge(wait_histograms[thread]);
+    sojourn_histograms[0].merge(sojourn_histograms[thread]);
+  }
+
+  // Return.
+  return CompletionSink(waits, sojourns, wait_histograms[0], sojourn_histograms[0]);
+}
+//
+//  Terminating Precompiler Directives  ////////////////////////////////////////
+//
+#endif // COLUMN_KERNELS_CPP_
+//
@@ -0,0 +1,82 @@
+/**
+ *
+ * @file column_kernels.h
+ *
+ * @brief Namespace for vectorized, multi-threaded reductions over customer
+ *        columns.
+ *
+ * @author Josh Wiley
+ *
+ * @details Kernels over contiguous arrival, transaction length, and
+ *          departure arrays (a retained trace, or a CustomerTable's columns)
+ *          that produce the same summaries the simulation keeps as it runs.
+ *          The AVX2 or SSE2 path is chosen at compile time (build with
+ *          -mavx2 or -march=native for AVX2), with a scalar fallback.
+ *
+ */
+//
+//  Preprocessor Directives  ///////////////////////////////////////////////////
+//
+#ifndef COLUMN_KERNELS_H_
+#define COLUMN_KERNELS_H_
+//
+//  Header Files  //////////////////////////////////////////////////////////////
+//
+#include <cstddef>
+#include <cstdint>
+#include "../Statistics/RunningStatistics.h"
+#include "../ServiceQueueSimulation/CompletionSink.h"
+//
+//  Namespace Definition  //////////////////////////////////////////////////////
+//
+namespace column_kernels
+{
+  // Instruction set in use.
+  const char* instruction_set(); /**< Returns name of the vector instruction set the kernels were built for. */
+
+  // Wait and sojourn columns.
+  void waits_and_sojourns(
+    const unsigned int*,
+    const unsigned int*,
+    const unsigned int*,
+    size_t,
+    unsigned int*,
+    unsigned int*
+  ); /**< Computes departure - arrival (sojourn) and sojourn - transaction length (wait) for each customer. */
+
+  // Sum and extrema.
+  void sum_min_max(
+    const unsigned int*,
+    size_t,
+    std::uint64_t&,
+    unsigned int&,
+    unsigned int&
+  ); /**< Computes exact 64-bit sum, min, and max of a column. */
+
+  // Squared deviations.
+  double sum_squared_deviations(
+    const unsigned int*,
+    size_t,
+    double
+  ); /**< Computes the sum of (value - mean)^2 over a column. */
+
+  // Column summary.
+  RunningStatistics summarize_column(
+    const unsigned int*,
+    size_t
+  ); /**< Summarizes a column (count, sum, extrema, and squared deviations) in two vectorized passes. */
+
+  // Whole trace.
+  CompletionSink summarize_customers(
+    const unsigned int*,
+    const unsigned int*,
+    const unsigned int*,
+    size_t,
+    unsigned int threads = 0
+  ); /**< Folds every customer of a trace into completion statistics, in parallel (0 threads = one per core). */
+}
+//
+//  Terminating Precompiler Directives  ////////////////////////////////////////
+//
+#endif // COLUMN_KERNELS_H_
+//
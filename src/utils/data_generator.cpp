@@ -15,9 +15,18 @@
 //
 #ifndef DATA_GENERATOR_CPP_
 #define DATA_GENERATOR_CPP_
+#define STREAM_RUN_LENGTH (size_t) 256
+#define GENERATION_BLOCK_LENGTH (size_t) 1024
 //
 //  Header Files  //////////////////////////////////////////////////////////////
 //
+#include <cmath>
+#include <limits>
+#include <thread>
+#include <algorithm>
+#include "../ArrivalSource/RandomArrivalSource.h"
+#include "../Random/Xoshiro256x4.h"
+#include "../Distribution/UniformDistribution.h"
 #include "data_generator.h"
 //
 //  Function Implementation  /////////////////////////////////////////////////
@@ -28,7 +37,10 @@
  *        list
  *
  * @details Generates the specified amount of random, unsigned integers to
- *          construct Customer objects
+ *          construct Customer objects. Values are drawn in blocks (arrival
+ *          times, then transaction lengths) from a generator private to the
+ *          call, so the data set depends only on the seed and concurrent
+ *          calls do not interfere
  *
  * @param[in] size
  *            The number of random values and final size of the data set
@@ -45,35 +57,386 @@
  * @param[in] right_max
  *            Maximum value for items on the right side of each pair
  *
+ * @param[in] seed
+ *            Seed of the generator
+ *
  * @param[out] data_set_ptr
  *             A shared pointer to the container that data will be placed into
  *
  */
-void data_generator::generate_random_data(unsigned int size, unsigned int left_min, unsigned int left_max, unsigned int right_min, unsigned int right_max, std::shared_ptr< std::list< Customer > > data_set_ptr)
+void data_generator::generate_random_data(unsigned int size, unsigned int left_min, unsigned int left_max, unsigned int right_min, unsigned int right_max, std::uint64_t seed, std::shared_ptr< std::list< Customer > > data_set_ptr)
 {
   // Ensure data set is empty.
   data_set_ptr->clear();
 
-  // Seed the random value generator.
-  std::srand(
-    std::chrono::high_resolution_clock::now()
-    .time_since_epoch()
-    .count()
-  );
+  // Private generator and blocks of values.
+  auto engine = Xoshiro256x4(seed);
+  unsigned int lefts[GENERATION_BLOCK_LENGTH];
+  unsigned int rights[GENERATION_BLOCK_LENGTH];
 
   // Generate data set.
-  for (unsigned int i = 0; i < size; i++)
+  for (auto done = (size_t) 0; done < size; )
+  {
+    // Draw block.
+    auto length = std::min(GENERATION_BLOCK_LENGTH, size - done);
+    engine.fill_uniform(lefts, length, left_min, left_max);
+    engine.fill_uniform(rights, length, right_min, right_max);
+
+    // Emplace pairs of random values.
+    for (auto i = (size_t) 0; i < length; i++)
+    {
+      // Emplace.
+      data_set_ptr->push_back(Customer(lefts[i], rights[i]));
+    }
+
+    // Advance.
+    done += length;
+  }
+}
+//
+//  Function Implementation  /////////////////////////////////////////////////
+//
+/**
+ *
+ * @brief Generates Customers with random data, already sorted by arrival
+ *        time, and places them into provided list
+ *
+ * @details Draws the same distribution as generate_random_data followed by
+ *          a sort, in O(n) time and without the sort's counting array, by
+ *          draining a RandomArrivalSource
+ *
+ * @param[in] size
+ *            The number of customers and final size of the data set
+ *
+ * @param[in] left_min
+ *            Minimum arrival time
+ *
+ * @param[in] left_max
+ *            Maximum arrival time
+ *
+ * @param[in] right_min
+ *            Minimum transaction length
+ *
+ * @param[in] right_max
+ *            Maximum transaction length
+ *
+ * @param[in] seed
+ *            Seed of the generator
+ *
+ * @param[out] data_set_ptr
+ *             A shared pointer to the container that data will be placed into
+ *
+ */
+void data_generator::generate_sorted_random_data(unsigned int size, unsigned int left_min, unsigned int left_max, unsigned int right_min, unsigned int right_max, std::uint64_t seed, std::shared_ptr< std::list< Customer > > data_set_ptr)
+{
+  // Uniform transaction lengths.
+  generate_sorted_random_data(
+    size,
+    left_min,
+    left_max,
+    std::make_shared< UniformDistribution >(right_min, right_max),
+    seed,
+    data_set_ptr
+  );
+}
+//
+//  Function Implementation  /////////////////////////////////////////////////
+//
+/**
+ *
+ * @brief Generates Customers with uniform arrival times, already sorted,
+ *        and transaction lengths drawn from a distribution, and places them
+ *        into provided list
+ *
+ * @details Drains a RandomArrivalSource (ordered-uniform spacings, O(n));
+ *          simulations that do not need the data set kept can take the
+ *          source directly instead
+ *
+ * @param[in] size
+ *            The number of customers and final size of the data set
+ *
+ * @param[in] left_min
+ *            Minimum arrival time
+ *
+ * @param[in] left_max
+ *            Maximum arrival time
+ *
+ * @param[in] transaction
+ *            Distribution of transaction lengths
+ *
+ * @param[in] seed
+ *            Seed of the generator
+ *
+ * @param[out] data_set_ptr
+ *             A shared pointer to the container that data will be placed into
+ *
+ */
+void data_generator::generate_sorted_random_data(unsigned int size, unsigned int left_min, unsigned int left_max, std::shared_ptr< const Distribution > transaction, std::uint64_t seed, std::shared_ptr< std::list< Customer > > data_set_ptr)
+{
+  // Ensure data set is empty.
+  data_set_ptr->clear();
+
+  // Private source.
+  auto source = RandomArrivalSource(size, left_min, left_max, transaction, seed);
+
+  // Generate data set, earliest arrival first.
+  auto customer = Customer();
+  while (source.next(customer))
+  {
+    // Append.
+    data_set_ptr->push_back(customer);
+  }
+}
+//
+//  Function Implementation  /////////////////////////////////////////////////
+//
+/**
+ *
+ * @brief Generates Customers arriving as a Poisson process and places them
+ *        into provided list, in order of arrival
+ *
+ * @details Arrival times are the running sum of exponential interarrival
+ *          times (truncated to whole time units), so the data set comes out
+ *          sorted in one O(n) pass. Arrival times saturate at the largest
+ *          representable time rather than wrapping
+ *
+ * @param[in] size
+ *            The number of customers and final size of the data set
+ *
+ * @param[in] start_time
+ *            Time the arrival process starts
+ *
+ * @param[in] mean_interarrival
+ *            Mean time between arrivals (1 / arrival rate)
+ *
+ * @param[in] right_min
+ *            Minimum transaction length
+ *
+ * @param[in] right_max
+ *            Maximum transaction length
+ *
+ * @param[in] seed
+ *            Seed of the generator
+ *
+ * @param[out] data_set_ptr
+ *             A shared pointer to the container that data will be placed into
+ *
+ */
+void data_generator::generate_poisson_data(unsigned int size, unsigned int start_time, double mean_interarrival, unsigned int right_min, unsigned int right_max, std::uint64_t seed, std::shared_ptr< std::list< Customer > > data_set_ptr)
+{
+  // Ensure data set is empty.
+  data_set_ptr->clear();
+
+  // Private generator and blocks of values.
+  auto engine = Xoshiro256x4(seed);
+  double units[GENERATION_BLOCK_LENGTH];
+  unsigned int rights[GENERATION_BLOCK_LENGTH];
+
+  // Clock, and the latest time an arrival can be given.
+  auto elapsed = 0.0;
+  auto horizon = (double) (std::numeric_limits< unsigned int >::max() - start_time);
+
+  // Generate data set, earliest arrival first.
+  for (auto done = (size_t) 0; done < size; )
   {
-    // Emplace pair of random values.
-    data_set_ptr->push_back(
-      Customer(
-        ((unsigned int) std::rand() % (left_max + 1 - left_min)) + left_min,
-        ((unsigned int) std::rand() % (right_max + 1 - right_min)) + right_min
-      )
-    );
+    // Draw block.
+    auto length = std::min(GENERATION_BLOCK_LENGTH, (size_t) size - done);
+    engine.fill_unit(units, length);
+    engine.fill_uniform(rights, length, right_min, right_max);
+
+    // Emplace customers at successive arrivals.
+    for (auto i = (size_t) 0; i < length; i++)
+    {
+      // Next arrival (1 - u is in (0, 1]).
+      elapsed -= mean_interarrival * std::log(1.0 - units[i]);
+
+      // Emplace.
+      data_set_ptr->push_back(Customer(start_time + (unsigned int) std::min(elapsed, horizon), rights[i]));
+    }
+
+    // Advance.
+    done += length;
   }
 }
 //
+//  Function Implementation  /////////////////////////////////////////////////
+//
+/**
+ *
+ * @brief Generates Customers whose interarrival and transaction times are
+ *        drawn from distributions and places them into provided list, in
+ *        order of arrival
+ *
+ * @details Arrival times are the running sum of interarrival times (a
+ *          renewal process; exponential interarrivals give Poisson
+ *          arrivals), so the data set comes out sorted in one O(n) pass.
+ *          Both distributions are sampled in batches, each from its own
+ *          stream. Arrival times saturate at the largest representable time
+ *          rather than wrapping
+ *
+ * @param[in] size
+ *            The number of customers and final size of the data set
+ *
+ * @param[in] start_time
+ *            Time the arrival process starts (the first arrival is one
+ *            interarrival time later)
+ *
+ * @param[in] interarrival
+ *            Distribution of times between arrivals
+ *
+ * @param[in] transaction
+ *            Distribution of transaction lengths
+ *
+ * @param[in] seed
+ *            Seed of the generator
+ *
+ * @param[out] data_set_ptr
+ *             A shared pointer to the container that data will be placed into
+ *
+ */
+void data_generator::generate_renewal_data(unsigned int size, unsigned int start_time, const Distribution& interarrival, const Distribution& transaction, std::uint64_t seed, std::shared_ptr< std::list< Customer > > data_set_ptr)
+{
+  // Ensure data set is empty.
+  data_set_ptr->clear();
+
+  // Private generators (interarrivals, and transaction lengths far ahead of them).
+  auto transaction_parent = Xoshiro256(seed);
+  transaction_parent.long_jump();
+  auto interarrival_engine = Xoshiro256x4(Xoshiro256(seed));
+  auto transaction_engine = Xoshiro256x4(transaction_parent);
+  unsigned int gaps[GENERATION_BLOCK_LENGTH];
+  unsigned int rights[GENERATION_BLOCK_LENGTH];
+
+  // Clock, and the latest time an arrival can be given.
+  auto clock = (std::uint64_t) start_time;
+  auto latest = (std::uint64_t) std::numeric_limits< unsigned int >::max();
+
+  // Generate data set, earliest arrival first.
+  for (auto done = (size_t) 0; done < size; )
+  {
+    // Draw block.
+    auto length = std::min(GENERATION_BLOCK_LENGTH, (size_t) size - done);
+    interarrival.sample(interarrival_engine, gaps, length);
+    transaction.sample(transaction_engine, rights, length);
+
+    // Emplace customers at successive arrivals.
+    for (auto i = (size_t) 0; i < length; i++)
+    {
+      // Next arrival.
+      clock = std::min(clock + gaps[i], latest);
+
+      // Emplace.
+      data_set_ptr->push_back(Customer((unsigned int) clock, rights[i]));
+    }
+
+    // Advance.
+    done += length;
+  }
+}
+//
+//  Function Implementation  /////////////////////////////////////////////////
+//
+/**
+ *
+ * @brief Generates Customers with random data, in order of arrival, and
+ *        streams them through a single-producer/single-consumer queue
+ *
+ * @details Draws the same distribution as generate_random_data followed by
+ *          a sort, without holding the data set (see RandomArrivalSource),
+ *          so each customer can be handed to the consumer as soon as it
+ *          exists. Customers are pushed in runs and the producer yields
+ *          while the queue is full. Meant to run on its own thread; it is
+ *          the queue's only producer.
+ *
+ * @param[in] size
+ *            The number of customers to generate
+ *
+ * @param[in] left_min
+ *            Minimum arrival time
+ *
+ * @param[in] left_max
+ *            Maximum arrival time
+ *
+ * @param[in] right_min
+ *            Minimum transaction length
+ *
+ * @param[in] right_max
+ *            Maximum transaction length
+ *
+ * @param[in] seed
+ *            Seed of the generator
+ *
+ * @param[out] feed_ptr
+ *             A shared pointer to the queue customers are streamed into
+ *             (closed once the last customer is in)
+ *
+ * @param[in] on_run
+ *            Called on the producer's thread with each run once it is
+ *            pushed, e.g. to log the data set as it streams (may be empty)
+ *
+ */
+void data_generator::stream_sorted_random_data(unsigned int size, unsigned int left_min, unsigned int left_max, unsigned int right_min, unsigned int right_max, std::uint64_t seed, std::shared_ptr< QueueSpsc< Customer > > feed_ptr, std::function< void(const Customer*, size_t) > on_run)
+{
+  // Private generator.
+  auto source = RandomArrivalSource(
+    size,
+    left_min,
+    left_max,
+    right_min,
+    right_max,
+    seed
+  );
+
+  // Run buffer.
+  Customer run[STREAM_RUN_LENGTH];
+  auto run_size = (size_t) 0;
+
+  // Generate data set, earliest arrival first.
+  while (true)
+  {
+    // Fill run.
+    run_size = 0;
+    while (run_size != STREAM_RUN_LENGTH && source.next(run[run_size]))
+    {
+      // Advance.
+      run_size++;
+    }
+
+    // Push run, waiting for room as needed.
+    auto pushed = (size_t) 0;
+    while (pushed != run_size)
+    {
+      // Push what fits.
+      auto count = feed_ptr->enqueue_range(run + pushed, run + run_size);
+      pushed += count;
+
+      // Full?
+      if (count == 0)
+      {
+        // Let the consumer catch up.
+        std::this_thread::yield();
+      }
+    }
+
+    // Observed?
+    if (on_run && run_size != 0)
+    {
+      // Hand over run.
+      on_run(run, run_size);
+    }
+
+    // Last run?
+    if (run_size != STREAM_RUN_LENGTH)
+    {
+      // Done.
+      break;
+    }
+  }
+
+  // End of stream.
+  feed_ptr->close();
+}
+//
 //  Terminating Precompiler Directives  ////////////////////////////////////////
 //
 #endif // DATA_GENERATOR_CPP_
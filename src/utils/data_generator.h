@@ -18,11 +18,13 @@
 //
 //  Header Files  //////////////////////////////////////////////////////////////
 //
-#include <cstdlib>
-#include <chrono>
+#include <cstdint>
 #include <list>
 #include <memory>
+#include <functional>
+#include "../Queue/QueueSpsc.h"
 #include "../ServiceQueueSimulation/Customer.h"
+#include "../Distribution/Distribution.h"
 //
 //  Namespace Definition  //////////////////////////////////////////////////////
 //
@@ -35,8 +37,63 @@ namespace data_generator
     unsigned int,
     unsigned int,
     unsigned int,
+    std::uint64_t,
     std::shared_ptr< std::list< Customer > >
-  ); /**< Generates random numbers and stores in list parameter. */
+  ); /**< Generates random numbers from a seeded generator and stores in list parameter. */
+
+  // Generate random data set in order of arrival.
+  void generate_sorted_random_data(
+    unsigned int,
+    unsigned int,
+    unsigned int,
+    unsigned int,
+    unsigned int,
+    std::uint64_t,
+    std::shared_ptr< std::list< Customer > >
+  ); /**< Generates uniform customers already sorted by arrival time (ordered-uniform spacings) and stores in list parameter. */
+
+  // Generate random data set in order of arrival, with transaction lengths from a distribution.
+  void generate_sorted_random_data(
+    unsigned int,
+    unsigned int,
+    unsigned int,
+    std::shared_ptr< const Distribution >,
+    std::uint64_t,
+    std::shared_ptr< std::list< Customer > >
+  ); /**< Generates customers with uniform arrival times, already sorted, and transaction lengths drawn from a distribution, and stores in list parameter. */
+
+  // Generate Poisson arrivals in order of arrival.
+  void generate_poisson_data(
+    unsigned int,
+    unsigned int,
+    double,
+    unsigned int,
+    unsigned int,
+    std::uint64_t,
+    std::shared_ptr< std::list< Customer > >
+  ); /**< Generates customers with exponential interarrival times, in order of arrival, and stores in list parameter. */
+
+  // Generate arrivals with interarrival and transaction times from distributions.
+  void generate_renewal_data(
+    unsigned int,
+    unsigned int,
+    const Distribution&,
+    const Distribution&,
+    std::uint64_t,
+    std::shared_ptr< std::list< Customer > >
+  ); /**< Generates customers whose interarrival and transaction times are drawn from distributions, in order of arrival, and stores in list parameter. */
+
+  // Stream random data set in order of arrival.
+  void stream_sorted_random_data(
+    unsigned int,
+    unsigned int,
+    unsigned int,
+    unsigned int,
+    unsigned int,
+    std::uint64_t,
+    std::shared_ptr< QueueSpsc< Customer > >,
+    std::function< void(const Customer*, size_t) > = nullptr
+  ); /**< Generates customers already sorted by arrival time and feeds them to a queue, closing it at the end (optionally handing each run to an observer). */
 }
 //
 //  Terminating Precompiler Directives  ////////////////////////////////////////